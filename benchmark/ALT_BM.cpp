@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static void ALT_Preprocessing_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        CXXGRAPH::SHORTESTPATH::ALT<int> alt(g);
+        auto result = alt.build();
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ALT_Preprocessing_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
+
+static void ALT_Query_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt(g);
+    alt.build();
+    auto source = nodes.at(0);
+    auto target = nodes.at(state.range(0) * state.range(0) - 1);
+    for (auto _ : state)
+    {
+        auto result = alt.query(*source, *target);
+    }
+    // speedup in explored nodes against Dijkstra, that settles the whole grid in the worst case
+    state.counters["settled"] = alt.getLastQuerySettledNodes();
+    state.counters["memory"] = alt.getMemorySize();
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ALT_Query_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
+
+static void ALT_FromReadedCitHep(benchmark::State &state)
+{
+    auto edgeSet = cit_graph_ptr->getEdgeSet();
+    CXXGRAPH::T_EdgeSet<int> weightedEdgeSet;
+    std::vector<CXXGRAPH::DirectedWeightedEdge<int> *> weightedEdges;
+    for (auto e : edgeSet)
+    {
+        weightedEdges.push_back(new CXXGRAPH::DirectedWeightedEdge<int>(e->getId(), e->getNodePair(), 1));
+        weightedEdgeSet.insert(weightedEdges.back());
+    }
+    CXXGRAPH::Graph<int> g(weightedEdgeSet);
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt(g);
+    alt.build();
+    auto source = (*(edgeSet.begin()))->getNodePair().first;
+    auto target = (*(edgeSet.begin()))->getNodePair().second;
+    for (auto _ : state)
+    {
+        auto result = alt.query(*source, *target);
+    }
+    for (auto e : weightedEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ALT_FromReadedCitHep);
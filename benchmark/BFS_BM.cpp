@@ -93,3 +93,75 @@ static void CONCURRENCY_BFS_FromReadedCitHep(benchmark::State &state)
 
 BENCHMARK(CONCURRENCY_BFS_FromReadedCitHep);
 
+
+static void CONCURRENCY_BFS_Threads_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto &result = g.concurrency_breadth_first_search(*(range_start->second->getNodePair().first), state.range(1));
+    }
+}
+BENCHMARK(CONCURRENCY_BFS_Threads_X)->RangeMultiplier(2)->Ranges({{(unsigned long)1 << 18, (unsigned long)1 << 18}, {1, 8}});
+
+static void DIRECTION_OPTIMIZING_BFS_Threads_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.direction_optimizing_breadth_first_search(*(range_start->second->getNodePair().first), state.range(1));
+    }
+}
+BENCHMARK(DIRECTION_OPTIMIZING_BFS_Threads_X)->RangeMultiplier(2)->Ranges({{(unsigned long)1 << 18, (unsigned long)1 << 18}, {1, 8}});
+
+static void DIRECTION_OPTIMIZING_BFS_FromReadedCitHep(benchmark::State &state)
+{
+    auto edgeSet = cit_graph_ptr->getEdgeSet();
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->direction_optimizing_breadth_first_search(*((*(edgeSet.begin()))->getNodePair().first), state.range(0));
+    }
+}
+BENCHMARK(DIRECTION_OPTIMIZING_BFS_FromReadedCitHep)->RangeMultiplier(2)->Range(1, 8);
+
+static void BFS_Range_FirstLevels_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    auto csr = std::make_shared<const CXXGRAPH::CSRGraph<int>>(g.getEdgeSet());
+    for (auto _ : state)
+    {
+        CXXGRAPH::TRAVERSAL::BreadthFirstRange<int> range(csr, range_start->second->getNodePair().first);
+        for (const auto &step : range)
+        {
+            if (step.depth > 2)
+            {
+                break;
+            }
+        }
+    }
+}
+BENCHMARK(BFS_Range_FirstLevels_X)->RangeMultiplier(18)->Range((unsigned long)1, (unsigned long)1 << 18);
@@ -31,4 +31,42 @@ static void BellmanFord_FromReadedCitHep(benchmark::State &state)
     }
 }
 
-BENCHMARK(BellmanFord_FromReadedCitHep);
\ No newline at end of file
+BENCHMARK(BellmanFord_FromReadedCitHep);
+
+static void BellmanFord_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.bellmanford(*(nodes.at(0)), *(nodes.at(state.range(0) * state.range(0) - 1)));
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(BellmanFord_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
+
+static void PARALLEL_BellmanFord_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.bellmanford(*(nodes.at(0)), *(nodes.at(state.range(0) * state.range(0) - 1)), 8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_BellmanFord_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
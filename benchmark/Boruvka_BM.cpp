@@ -31,4 +31,41 @@ static void Boruvka_FromReadedCitHep(benchmark::State &state)
     }
 }
 
-BENCHMARK(Boruvka_FromReadedCitHep);
\ No newline at end of file
+BENCHMARK(Boruvka_FromReadedCitHep);
+static void Boruvka_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.boruvka();
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Boruvka_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
+
+static void PARALLEL_Boruvka_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.boruvka(8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_Boruvka_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
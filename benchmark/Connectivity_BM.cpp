@@ -61,4 +61,48 @@ static void StrongConnectivity_FromReadedCitHep(benchmark::State &state)
     }
 }
 
-BENCHMARK(StrongConnectivity_FromReadedCitHep);
\ No newline at end of file
+BENCHMARK(StrongConnectivity_FromReadedCitHep);
+static void ConnectedComponents_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = undirectedEdges.begin();
+    auto range_end = undirectedEdges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.connectedComponents();
+    }
+}
+BENCHMARK(ConnectedComponents_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void PARALLEL_ConnectedComponents_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = undirectedEdges.begin();
+    auto range_end = undirectedEdges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.connectedComponents(8);
+    }
+}
+BENCHMARK(PARALLEL_ConnectedComponents_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void WeaklyConnectedComponents_FromReadedCitHep(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->connectedComponents(state.range(0));
+    }
+}
+BENCHMARK(WeaklyConnectedComponents_FromReadedCitHep)->RangeMultiplier(2)->Range(1, 8);
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static void ContractionHierarchy_Preprocessing_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(g);
+        auto result = ch.build();
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ContractionHierarchy_Preprocessing_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void ContractionHierarchy_Query_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(g);
+    ch.build();
+    auto source = nodes.at(0);
+    auto target = nodes.at(state.range(0) * state.range(0) - 1);
+    for (auto _ : state)
+    {
+        auto result = ch.query(*source, *target);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ContractionHierarchy_Query_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void ContractionHierarchy_Dijkstra_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    auto source = nodes.at(0);
+    auto target = nodes.at(state.range(0) * state.range(0) - 1);
+    for (auto _ : state)
+    {
+        auto result = g.dijkstra(*source, *target);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ContractionHierarchy_Dijkstra_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
@@ -30,4 +30,23 @@ static void Dial_FromReadedCitHep(benchmark::State &state)
     }
 }
 
-BENCHMARK(Dial_FromReadedCitHep);
\ No newline at end of file
+BENCHMARK(Dial_FromReadedCitHep);
+
+static void Dial_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.dial(*(nodes.at(0)), 10);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Dial_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 8);
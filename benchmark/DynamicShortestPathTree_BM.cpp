@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+// every iteration changes the weight of an edge and computes the distance of the last node of the grid
+static void Dijkstra_WeightUpdate_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    unsigned long i = 0;
+    for (auto _ : state)
+    {
+        auto edge = gridEdges[(i * 7919) % gridEdges.size()];
+        g.setEdgeWeight(edge->getId(), static_cast<double>(i % 10 + 1));
+        auto result = g.dijkstra(*(nodes.at(0)), *(nodes.at(state.range(0) * state.range(0) - 1)));
+        ++i;
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Dijkstra_WeightUpdate_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void DynamicShortestPathTree_WeightUpdate_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::DynamicShortestPathTree<int> tree(g, *(nodes.at(0)));
+    unsigned long i = 0;
+    for (auto _ : state)
+    {
+        auto edge = gridEdges[(i * 7919) % gridEdges.size()];
+        g.setEdgeWeight(edge->getId(), static_cast<double>(i % 10 + 1));
+        auto result = tree.getDistance(*(nodes.at(state.range(0) * state.range(0) - 1)));
+        ++i;
+    }
+    state.counters["repairedPerUpdate"] = static_cast<double>(tree.getTotalRepairedNodes()) / tree.getNumberOfUpdates();
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(DynamicShortestPathTree_WeightUpdate_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
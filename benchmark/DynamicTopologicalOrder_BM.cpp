@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+// insertion of the random edges rejecting the ones that close a cycle, with the incremental order
+static void DynamicTopologicalOrder_X(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        CXXGRAPH::Graph<int> g;
+        CXXGRAPH::TRAVERSAL::DynamicTopologicalOrder<int> order(g);
+        for (auto it = edges.begin(); it != edges.end() && it->first < (unsigned long)state.range(0); ++it)
+        {
+            order.addEdge(it->second);
+        }
+        state.counters["visited/update"] = order.getAmortizedVisitedNodes();
+    }
+}
+BENCHMARK(DynamicTopologicalOrder_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+// the same insertions with a cycle check of the whole graph after every edge
+static void CycleCheckPerInsert_X(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        CXXGRAPH::Graph<int> g;
+        for (auto it = edges.begin(); it != edges.end() && it->first < (unsigned long)state.range(0); ++it)
+        {
+            g.addEdge(it->second);
+            if (g.isCyclicDirectedGraphDFS())
+            {
+                g.removeEdge(it->second->getId());
+            }
+        }
+    }
+}
+BENCHMARK(CycleCheckPerInsert_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 12);
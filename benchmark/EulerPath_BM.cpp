@@ -20,3 +20,32 @@ static void EulerPath_X(benchmark::State &state)
     }
 }
 BENCHMARK(EulerPath_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+// a cycle of the first nodes with a chord every two nodes, so every node has even degree
+static void Hierholzer_Circuit_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    const unsigned long n = state.range(0);
+    std::vector<CXXGRAPH::UndirectedEdge<int> *> circuitEdges;
+    for (unsigned long i = 0; i < n; ++i)
+    {
+        circuitEdges.push_back(new CXXGRAPH::UndirectedEdge<int>(i, *nodes.at(i), *nodes.at((i + 1) % n)));
+    }
+    for (unsigned long i = 0; i + 1 < n; i += 2)
+    {
+        circuitEdges.push_back(new CXXGRAPH::UndirectedEdge<int>(n + i, *nodes.at(i), *nodes.at((i + 2) % n)));
+    }
+    for (auto e : circuitEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.hierholzer();
+    }
+    for (auto e : circuitEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Hierholzer_Circuit_X)->RangeMultiplier(16)->Range((unsigned long)16, (unsigned long)1 << 16);
@@ -94,3 +94,41 @@ static void BM_FWNoWeighted(benchmark::State &state)
 }
 
 BENCHMARK(BM_FWNoWeighted);
+
+static void FWMatrix_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.floydWarshallMatrix();
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(FWMatrix_Grid_X)->RangeMultiplier(2)->Range((unsigned long)4, (unsigned long)1 << 5);
+
+static void PARALLEL_FWMatrix_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.floydWarshallMatrix(8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_FWMatrix_Grid_X)->RangeMultiplier(2)->Range((unsigned long)4, (unsigned long)1 << 5);
@@ -19,4 +19,32 @@ static void GraphSlicing_X(benchmark::State &state)
         auto &result = g.graph_slicing(*(range_start->second->getNodePair().first));
     }
 }
-BENCHMARK(GraphSlicing_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 8);
+BENCHMARK(GraphSlicing_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void PARALLEL_GraphSlicing_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.graph_slicing(*(range_start->second->getNodePair().first), 8);
+    }
+}
+BENCHMARK(PARALLEL_GraphSlicing_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void GraphSlicing_FromReadedCitHep(benchmark::State &state)
+{
+    auto edgeSet = cit_graph_ptr->getEdgeSet();
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->graph_slicing(*((*(edgeSet.begin()))->getNodePair().first), state.range(0));
+    }
+}
+BENCHMARK(GraphSlicing_FromReadedCitHep)->RangeMultiplier(2)->Range(1, 8);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static void Johnson_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.johnson();
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Johnson_Grid_X)->RangeMultiplier(2)->Range((unsigned long)4, (unsigned long)1 << 5);
+
+static void PARALLEL_Johnson_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.johnson(8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_Johnson_Grid_X)->RangeMultiplier(2)->Range((unsigned long)4, (unsigned long)1 << 5);
+
+static void STREAMED_Johnson_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        auto result = g.johnson([&sum](const CXXGRAPH::Node<int> *, const std::vector<double> &distances)
+                                { sum += distances.front(); },
+                                8);
+        benchmark::DoNotOptimize(sum);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(STREAMED_Johnson_Grid_X)->RangeMultiplier(2)->Range((unsigned long)4, (unsigned long)1 << 5);
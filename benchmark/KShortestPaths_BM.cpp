@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static void KShortestPaths_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.kShortestPaths(*(nodes.at(0)), *(nodes.at(state.range(0) * state.range(0) - 1)), 8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(KShortestPaths_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void PARALLEL_KShortestPaths_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.kShortestPaths(*(nodes.at(0)), *(nodes.at(state.range(0) * state.range(0) - 1)), 8, 8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_KShortestPaths_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static std::vector<const CXXGRAPH::Node<int> *> gridCorner(unsigned long width, unsigned long size)
+{
+    std::vector<const CXXGRAPH::Node<int> *> corner;
+    for (unsigned long i = 0; i < size && i < width * width; ++i)
+    {
+        corner.push_back(nodes.at((i / 8) * width + i % 8));
+    }
+    return corner;
+}
+
+static void ManyToMany_Dijkstra_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    auto sources = gridCorner(state.range(0), 64);
+    auto targets = sources;
+    for (auto _ : state)
+    {
+        auto result = g.manyToMany(sources, targets);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ManyToMany_Dijkstra_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void PARALLEL_ManyToMany_Dijkstra_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    auto sources = gridCorner(state.range(0), 64);
+    auto targets = sources;
+    for (auto _ : state)
+    {
+        auto result = g.manyToMany(sources, targets, 8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_ManyToMany_Dijkstra_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void ManyToMany_ContractionHierarchy_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(g);
+    ch.build();
+    auto sources = gridCorner(state.range(0), 64);
+    auto targets = sources;
+    for (auto _ : state)
+    {
+        auto result = ch.manyToMany(sources, targets);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ManyToMany_ContractionHierarchy_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void PARALLEL_ManyToMany_ContractionHierarchy_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(g);
+    ch.build();
+    auto sources = gridCorner(state.range(0), 64);
+    auto targets = sources;
+    for (auto _ : state)
+    {
+        auto result = ch.manyToMany(sources, targets, 8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_ManyToMany_ContractionHierarchy_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static std::vector<const CXXGRAPH::Node<int> *> gridSources(unsigned long width, unsigned long size)
+{
+    std::vector<const CXXGRAPH::Node<int> *> sources;
+    for (unsigned long i = 0; i < size; ++i)
+    {
+        sources.push_back(nodes.at((i * 7919) % (width * width)));
+    }
+    return sources;
+}
+
+static void MultiSourceBFS_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(64, nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    auto sources = gridSources(64, state.range(0));
+    for (auto _ : state)
+    {
+        auto result = g.multi_source_reachability(sources);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(MultiSourceBFS_Grid_X)->RangeMultiplier(4)->Range((unsigned long)64, (unsigned long)1 << 10);
+
+static void PARALLEL_MultiSourceBFS_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(64, nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    auto sources = gridSources(64, state.range(0));
+    for (auto _ : state)
+    {
+        auto result = g.multi_source_reachability(sources, 8);
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_MultiSourceBFS_Grid_X)->RangeMultiplier(4)->Range((unsigned long)64, (unsigned long)1 << 10);
+
+static void SingleSourceBFS_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(64, nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    auto sources = gridSources(64, state.range(0));
+    for (auto _ : state)
+    {
+        for (auto source : sources)
+        {
+            auto result = g.direction_optimizing_breadth_first_search(*source);
+        }
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(SingleSourceBFS_Grid_X)->RangeMultiplier(4)->Range((unsigned long)64, (unsigned long)1 << 10);
+
+static void MultiSourceBFS_FromReadedCitHep(benchmark::State &state)
+{
+    auto nodeSet = cit_graph_ptr->getNodeSet();
+    std::vector<const CXXGRAPH::Node<int> *> sources(nodeSet.begin(), nodeSet.end());
+    sources.resize(std::min<std::size_t>(sources.size(), state.range(0)));
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->multi_source_reachability(sources);
+    }
+}
+BENCHMARK(MultiSourceBFS_FromReadedCitHep)->RangeMultiplier(8)->Range((unsigned long)64, (unsigned long)512);
@@ -0,0 +1,92 @@
+#include <random>
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static void PLL_Preprocessing_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    double labelSize = 0;
+    for (auto _ : state)
+    {
+        CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(g);
+        auto result = pll.build();
+        labelSize = pll.getAverageLabelSize();
+    }
+    state.counters["labelSize"] = labelSize;
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PLL_Preprocessing_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void PLL_Query_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(g);
+    pll.build();
+    auto source = nodes.at(0);
+    auto target = nodes.at(state.range(0) * state.range(0) - 1);
+    for (auto _ : state)
+    {
+        auto result = pll.query(*source, *target);
+    }
+    state.counters["labelSize"] = pll.getAverageLabelSize();
+    state.counters["memory"] = pll.getMemorySize();
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PLL_Query_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void PLL_Preprocessing_FromReadedCitHep(benchmark::State &state)
+{
+    double labelSize = 0;
+    std::size_t memory = 0;
+    for (auto _ : state)
+    {
+        CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(*cit_graph_ptr);
+        auto result = pll.build();
+        labelSize = pll.getAverageLabelSize();
+        memory = pll.getMemorySize();
+    }
+    state.counters["labelSize"] = labelSize;
+    state.counters["memory"] = memory;
+}
+BENCHMARK(PLL_Preprocessing_FromReadedCitHep)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+static void PLL_Query_FromReadedCitHep(benchmark::State &state)
+{
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(*cit_graph_ptr);
+    pll.build();
+    auto nodeSet = cit_graph_ptr->getNodeSet();
+    std::vector<const CXXGRAPH::Node<int> *> queryNodes(nodeSet.begin(), nodeSet.end());
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> nodeDistribution(0, queryNodes.size() - 1);
+    std::vector<std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *>> queries;
+    for (int i = 0; i < 1024; ++i)
+    {
+        queries.emplace_back(queryNodes[nodeDistribution(generator)], queryNodes[nodeDistribution(generator)]);
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto result = pll.query(*queries[i % queries.size()].first, *queries[i % queries.size()].second);
+        ++i;
+    }
+    state.counters["labelSize"] = pll.getAverageLabelSize();
+    state.counters["buildTime"] = pll.getPreprocessingTime();
+}
+BENCHMARK(PLL_Query_FromReadedCitHep);
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+// the strongly connected components with kosaraju, tarjan and the parallel forward-backward algorithm
+
+static void Kosaraju_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.kosaraju();
+    }
+}
+BENCHMARK(Kosaraju_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void Tarjan_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.tarjan();
+    }
+}
+BENCHMARK(Tarjan_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void ForwardBackwardSCC_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.forward_backward_scc();
+    }
+}
+BENCHMARK(ForwardBackwardSCC_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void PARALLEL_ForwardBackwardSCC_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto range_start = edges.begin();
+    auto range_end = edges.find(state.range(0));
+    std::unordered_map<unsigned long, CXXGRAPH::Edge<int> *> edgesX;
+    edgesX.insert(range_start, range_end);
+    for (auto e : edgesX)
+        {
+            g.addEdge(&(*e.second));
+        }
+    for (auto _ : state)
+    {
+        auto result = g.forward_backward_scc(8);
+    }
+}
+BENCHMARK(PARALLEL_ForwardBackwardSCC_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void Kosaraju_FromReadedCitHep(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->kosaraju();
+    }
+}
+BENCHMARK(Kosaraju_FromReadedCitHep);
+
+static void Tarjan_FromReadedCitHep(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->tarjan();
+    }
+}
+BENCHMARK(Tarjan_FromReadedCitHep);
+
+static void ForwardBackwardSCC_FromReadedCitHep(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        auto result = cit_graph_ptr->forward_backward_scc(state.range(0));
+    }
+}
+BENCHMARK(ForwardBackwardSCC_FromReadedCitHep)->RangeMultiplier(2)->Range(1, 8);
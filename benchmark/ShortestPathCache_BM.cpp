@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+// queries from a few hub sources to all the targets of the grid
+static void Dijkstra_Hub_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        for (unsigned long i = 0; i < 64; ++i)
+        {
+            auto result = g.dijkstra(*(nodes.at(i % 4)), *(nodes.at(i * 7 % (state.range(0) * state.range(0)))));
+        }
+    }
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Dijkstra_Hub_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void ShortestPathCache_Hub_Grid_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto gridEdges = generateGridEdges(state.range(0), nodes);
+    for (auto e : gridEdges)
+    {
+        g.addEdge(e);
+    }
+    CXXGRAPH::SHORTESTPATH::ShortestPathCache<int> cache(g);
+    for (auto _ : state)
+    {
+        for (unsigned long i = 0; i < 64; ++i)
+        {
+            auto result = cache.dijkstra(*(nodes.at(i % 4)), *(nodes.at(i * 7 % (state.range(0) * state.range(0)))));
+        }
+    }
+    state.counters["hits"] = cache.getHits();
+    state.counters["misses"] = cache.getMisses();
+    for (auto e : gridEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(ShortestPathCache_Hub_Grid_X)->RangeMultiplier(2)->Range((unsigned long)8, (unsigned long)1 << 7);
+
+static void ShortestPathCache_FromReadedCitHep(benchmark::State &state)
+{
+    auto edgeSet = cit_graph_ptr->getEdgeSet();
+    CXXGRAPH::SHORTESTPATH::ShortestPathCache<int> cache(*cit_graph_ptr);
+    for (auto _ : state)
+    {
+        auto result = cache.dijkstra(*((*(edgeSet.begin()))->getNodePair().first), *((*(++edgeSet.begin()))->getNodePair().second));
+    }
+}
+BENCHMARK(ShortestPathCache_FromReadedCitHep);
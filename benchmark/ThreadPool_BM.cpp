@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static void ParallelFor_X(benchmark::State &state)
+{
+    std::vector<unsigned long> values(state.range(0), 1);
+    std::vector<unsigned long> sums(8, 0);
+    for (auto _ : state)
+    {
+        CXXGRAPH::parallelFor(0, values.size(), 8, 1024, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+                              {
+                                  for (auto i = begin; i < end; ++i)
+                                  {
+                                      sums[threadId] += values[i];
+                                  }
+                              });
+    }
+    benchmark::DoNotOptimize(sums);
+}
+BENCHMARK(ParallelFor_X)->RangeMultiplier(16)->Range((unsigned long)1 << 10, (unsigned long)1 << 22);
+
+static void TaskGroup_X(benchmark::State &state)
+{
+    std::atomic<unsigned long> counter(0);
+    for (auto _ : state)
+    {
+        CXXGRAPH::TaskGroup group;
+        for (long i = 0; i < state.range(0); ++i)
+        {
+            group.run([&counter]()
+                      { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        group.wait();
+    }
+}
+BENCHMARK(TaskGroup_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 12);
@@ -31,3 +31,58 @@ static void TopologicalSort_FromReadedCitHep(benchmark::State &state)
 }
 
 BENCHMARK(TopologicalSort_FromReadedCitHep);
+
+// the random edges oriented from the node with the lower index, so the graph is acyclic
+static std::vector<CXXGRAPH::DirectedEdge<int> *> generateDAGEdges(unsigned long numberOfEdges)
+{
+    std::vector<CXXGRAPH::DirectedEdge<int> *> dagEdges;
+    for (auto it = edges.begin(); it != edges.end() && it->first < numberOfEdges; ++it)
+    {
+        auto from = it->second->getNodePair().first;
+        auto to = it->second->getNodePair().second;
+        if (std::stoul(from->getUserId()) > std::stoul(to->getUserId()))
+        {
+            std::swap(from, to);
+        }
+        dagEdges.push_back(new CXXGRAPH::DirectedEdge<int>(it->first, *from, *to));
+    }
+    return dagEdges;
+}
+
+static void Kahn_DAG_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto dagEdges = generateDAGEdges(state.range(0));
+    for (auto e : dagEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.kahn();
+    }
+    for (auto e : dagEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(Kahn_DAG_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void PARALLEL_TopologicalLevels_DAG_X(benchmark::State &state)
+{
+    CXXGRAPH::Graph<int> g;
+    auto dagEdges = generateDAGEdges(state.range(0));
+    for (auto e : dagEdges)
+    {
+        g.addEdge(e);
+    }
+    for (auto _ : state)
+    {
+        auto result = g.topologicalLevels(8);
+    }
+    for (auto e : dagEdges)
+    {
+        delete e;
+    }
+}
+BENCHMARK(PARALLEL_TopologicalLevels_DAG_X)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
@@ -55,6 +55,30 @@ static std::map<unsigned long, CXXGRAPH::UndirectedEdge<int> *> generateRandomUn
     return edges;
 }
 
+// road-like weighted grid of width x width nodes, the random graphs have no structure for the shortest path speed-up techniques
+static std::vector<CXXGRAPH::UndirectedWeightedEdge<int> *> generateGridEdges(unsigned long width, const std::map<unsigned long, CXXGRAPH::Node<int> *> &nodes)
+{
+    std::vector<CXXGRAPH::UndirectedWeightedEdge<int> *> gridEdges;
+    unsigned int randSeed = (unsigned int)time(NULL);
+    unsigned long edgeId = 0;
+    for (unsigned long row = 0; row < width; row++)
+    {
+        for (unsigned long col = 0; col < width; col++)
+        {
+            auto node = nodes.at(row * width + col);
+            if (col + 1 < width)
+            {
+                gridEdges.push_back(new CXXGRAPH::UndirectedWeightedEdge<int>(edgeId++, *node, *(nodes.at(row * width + col + 1)), (rand_r(&randSeed) % 10) + 1));
+            }
+            if (row + 1 < width)
+            {
+                gridEdges.push_back(new CXXGRAPH::UndirectedWeightedEdge<int>(edgeId++, *node, *(nodes.at((row + 1) * width + col)), (rand_r(&randSeed) % 10) + 1));
+            }
+        }
+    }
+    return gridEdges;
+}
+
 static CXXGRAPH::Graph<int> *readGraph(const std::string &filename)
 {
     CXXGRAPH::Graph<int> *graph_ptr = new CXXGRAPH::Graph<int>();
@@ -9,6 +9,8 @@
 #include "Edge/UndirectedWeightedEdge.hpp"
 #include "Edge/Weighted.hpp"
 #include "Graph/Graph.hpp"
+#include "Graph/GraphObserver.hpp"
+#include "Graph/CSRGraph.hpp"
 #include "Node/Node.hpp"
 #include "Partitioning/Partition.hpp"
 #include "Partitioning/CoordinatedPartitionState.hpp"
@@ -24,5 +26,25 @@
 #include "Partitioning/PartitionState.hpp"
 #include "Partitioning/PartitionStrategy.hpp"
 #include "Partitioning/Record.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "ShortestPath/BlockedFloydWarshall.hpp"
+#include "ShortestPath/ContractionHierarchy.hpp"
+#include "ShortestPath/ALT.hpp"
+#include "ShortestPath/PrunedLandmarkLabeling.hpp"
+#include "ShortestPath/ShortestPathCache.hpp"
+#include "ShortestPath/YenKShortestPaths.hpp"
+#include "ShortestPath/DynamicShortestPathTree.hpp"
+#include "Traversal/ConcurrentBFS.hpp"
+#include "Traversal/ConnectedComponents.hpp"
+#include "Traversal/DepthFirstSearch.hpp"
+#include "Traversal/DirectionOptimizingBFS.hpp"
+#include "Traversal/DynamicTopologicalOrder.hpp"
+#include "Traversal/EulerianPath.hpp"
+#include "Traversal/GraphSlicing.hpp"
+#include "Traversal/MultiSourceBFS.hpp"
+#include "Traversal/ParallelBoruvka.hpp"
+#include "Traversal/ParallelKahn.hpp"
+#include "Traversal/StronglyConnectedComponents.hpp"
+#include "Traversal/TraversalRange.hpp"
 
 #endif // __CXXGRAPH_H__
\ No newline at end of file
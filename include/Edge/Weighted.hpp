@@ -34,6 +34,7 @@ namespace CXXGRAPH
 		Weighted(const double weight);
 		virtual ~Weighted() = default;
 		double getWeight() const;
+		// the Graphs that contain the edge are not notified, use Graph::setEdgeWeight
 		void setWeight(const double weight);
 	};
 
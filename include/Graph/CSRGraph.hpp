@@ -0,0 +1,389 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_CSRGRAPH_H__
+#define __CXXGRAPH_CSRGRAPH_H__
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <unordered_set>
+#include <unordered_map>
+
+#include "Node/Node.hpp"
+#include "Edge/Edge.hpp"
+#include "Edge/Weighted.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that store a read-only snapshot of an Edge Set in Compressed Sparse Row format.
+	/// Nodes are mapped to dense indices (in the same order of Graph::getNodeSet()), the edges
+	/// are stored as Structure of Arrays and the arcs of every node are stored contiguously, both
+	/// for the outgoing and for the incoming direction. An undirected edge produces two arcs,
+	/// every other edge produces a single arc from the first to the second node of its pair.
+	/// The neighbours of every node keep the order of the edge set iteration, so algorithms
+	/// working on the snapshot visit the nodes in the same order of the Adjacency Matrix.
+	/// ( This class is not Thread Safe during the construction, it is safe for concurrent reads )
+	template <typename T>
+	class CSRGraph
+	{
+	private:
+		std::vector<const Node<T> *> nodes = {};
+		std::unordered_map<const Node<T> *, std::size_t> nodeIndex = {};
+
+		std::vector<const Edge<T> *> edges = {};
+		std::vector<std::size_t> edgeFrom = {};
+		std::vector<std::size_t> edgeTo = {};
+		std::vector<double> edgeWeight = {};
+		std::vector<char> edgeWeighted = {};
+		std::vector<char> edgeUndirected = {};
+
+		std::vector<std::size_t> outOffset = {0};
+		std::vector<std::size_t> outTarget = {};
+		std::vector<std::size_t> outEdge = {};
+		std::vector<double> outWeight = {};
+
+		std::vector<std::size_t> inOffset = {0};
+		std::vector<std::size_t> inSource = {};
+		std::vector<std::size_t> inEdge = {};
+		std::vector<double> inWeight = {};
+
+		bool weighted = true;
+		bool directed = true;
+		bool undirected = true;
+
+	public:
+		CSRGraph() = default;
+		CSRGraph(const std::unordered_set<const Edge<T> *> &edgeSet);
+		~CSRGraph() = default;
+
+		std::size_t getNumberOfNodes() const;
+		std::size_t getNumberOfEdges() const;
+		std::size_t getNumberOfArcs() const;
+		/**
+		 * @brief Return the node with the given dense index
+		 */
+		const Node<T> *getNode(std::size_t index) const;
+		const std::vector<const Node<T> *> &getNodes() const;
+		/**
+		 * @brief Return the dense index of the given node, if the node is in the snapshot
+		 */
+		std::optional<std::size_t> getIndex(const Node<T> *node) const;
+
+		const std::vector<const Edge<T> *> &getEdges() const;
+		const std::vector<std::size_t> &getEdgeFrom() const;
+		const std::vector<std::size_t> &getEdgeTo() const;
+		/**
+		 * @brief The weight of every edge, 1.0 for the not weighted edges
+		 */
+		const std::vector<double> &getEdgeWeight() const;
+		const std::vector<char> &getEdgeWeighted() const;
+		const std::vector<char> &getEdgeUndirected() const;
+
+		/**
+		 * @brief The outgoing arcs of node v are in the range [getOutOffset()[v], getOutOffset()[v + 1])
+		 */
+		const std::vector<std::size_t> &getOutOffset() const;
+		const std::vector<std::size_t> &getOutTarget() const;
+		const std::vector<std::size_t> &getOutEdge() const;
+		const std::vector<double> &getOutWeight() const;
+		/**
+		 * @brief The incoming arcs of node v are in the range [getInOffset()[v], getInOffset()[v + 1])
+		 */
+		const std::vector<std::size_t> &getInOffset() const;
+		const std::vector<std::size_t> &getInSource() const;
+		const std::vector<std::size_t> &getInEdge() const;
+		const std::vector<double> &getInWeight() const;
+
+		std::size_t getOutDegree(std::size_t index) const;
+		std::size_t getInDegree(std::size_t index) const;
+
+		/**
+		 * @brief true if every edge of the snapshot is weighted
+		 */
+		bool isWeighted() const;
+		/**
+		 * @brief true if every edge of the snapshot is directed
+		 */
+		bool isDirected() const;
+		/**
+		 * @brief true if no edge of the snapshot is directed
+		 */
+		bool isUndirected() const;
+	};
+
+	template <typename T>
+	CSRGraph<T>::CSRGraph(const std::unordered_set<const Edge<T> *> &edgeSet)
+	{
+		// the endpoints of the edges sorted by address give the same order of Graph::getNodeSet(),
+		// and a sweep on them assigns the dense indices without a lookup for every edge
+		const auto m = edgeSet.size();
+		edges.assign(edgeSet.begin(), edgeSet.end());
+		std::vector<std::pair<const Node<T> *, std::size_t>> endpoints;
+		endpoints.reserve(2 * m);
+		for (std::size_t e = 0; e < m; ++e)
+		{
+			endpoints.emplace_back(edges[e]->getNodePair().first, 2 * e);
+			endpoints.emplace_back(edges[e]->getNodePair().second, 2 * e + 1);
+		}
+		std::sort(endpoints.begin(), endpoints.end(), [](const auto &a, const auto &b)
+				  { return std::less<const Node<T> *>()(a.first, b.first); });
+		edgeFrom.resize(m);
+		edgeTo.resize(m);
+		for (const auto &endpoint : endpoints)
+		{
+			if (nodes.empty() || nodes.back() != endpoint.first)
+			{
+				nodes.push_back(endpoint.first);
+			}
+			(endpoint.second % 2 == 0 ? edgeFrom : edgeTo)[endpoint.second / 2] = nodes.size() - 1;
+		}
+		nodeIndex.reserve(nodes.size());
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			nodeIndex[nodes[i]] = i;
+		}
+
+		edgeWeight.reserve(m);
+		edgeWeighted.reserve(m);
+		edgeUndirected.reserve(m);
+		const auto n = nodes.size();
+		std::vector<std::size_t> outCount(n + 1, 0);
+		std::vector<std::size_t> inCount(n + 1, 0);
+		for (std::size_t e = 0; e < m; ++e)
+		{
+			const auto &edge = edges[e];
+			auto from = edgeFrom[e];
+			auto to = edgeTo[e];
+			bool isWeightedEdge = edge->isWeighted().has_value() && edge->isWeighted().value();
+			bool isUndirectedEdge = edge->isDirected().has_value() && !edge->isDirected().value();
+			bool isDirectedEdge = edge->isDirected().has_value() && edge->isDirected().value();
+			edgeWeight.push_back(isWeightedEdge ? dynamic_cast<const Weighted *>(edge)->getWeight() : 1.0);
+			edgeWeighted.push_back(isWeightedEdge);
+			edgeUndirected.push_back(isUndirectedEdge);
+			weighted = weighted && isWeightedEdge;
+			directed = directed && isDirectedEdge;
+			undirected = undirected && !isDirectedEdge;
+
+			outCount[from + 1]++;
+			inCount[to + 1]++;
+			if (isUndirectedEdge)
+			{
+				outCount[to + 1]++;
+				inCount[from + 1]++;
+			}
+		}
+
+		// prefix sums give the start of every adjacency range
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			outCount[i + 1] += outCount[i];
+			inCount[i + 1] += inCount[i];
+		}
+		outOffset = outCount;
+		inOffset = inCount;
+		const auto arcs = outOffset[n];
+		outTarget.resize(arcs);
+		outEdge.resize(arcs);
+		outWeight.resize(arcs);
+		inSource.resize(arcs);
+		inEdge.resize(arcs);
+		inWeight.resize(arcs);
+
+		auto addArc = [this, &outCount, &inCount](std::size_t from, std::size_t to, std::size_t edge)
+		{
+			auto outPos = outCount[from]++;
+			outTarget[outPos] = to;
+			outEdge[outPos] = edge;
+			outWeight[outPos] = edgeWeight[edge];
+			auto inPos = inCount[to]++;
+			inSource[inPos] = from;
+			inEdge[inPos] = edge;
+			inWeight[inPos] = edgeWeight[edge];
+		};
+		for (std::size_t e = 0; e < edges.size(); ++e)
+		{
+			addArc(edgeFrom[e], edgeTo[e], e);
+			if (edgeUndirected[e])
+			{
+				addArc(edgeTo[e], edgeFrom[e], e);
+			}
+		}
+	}
+
+	template <typename T>
+	std::size_t CSRGraph<T>::getNumberOfNodes() const
+	{
+		return nodes.size();
+	}
+
+	template <typename T>
+	std::size_t CSRGraph<T>::getNumberOfEdges() const
+	{
+		return edges.size();
+	}
+
+	template <typename T>
+	std::size_t CSRGraph<T>::getNumberOfArcs() const
+	{
+		return outTarget.size();
+	}
+
+	template <typename T>
+	const Node<T> *CSRGraph<T>::getNode(std::size_t index) const
+	{
+		return nodes[index];
+	}
+
+	template <typename T>
+	const std::vector<const Node<T> *> &CSRGraph<T>::getNodes() const
+	{
+		return nodes;
+	}
+
+	template <typename T>
+	std::optional<std::size_t> CSRGraph<T>::getIndex(const Node<T> *node) const
+	{
+		auto it = nodeIndex.find(node);
+		if (it == nodeIndex.end())
+		{
+			return std::nullopt;
+		}
+		return it->second;
+	}
+
+	template <typename T>
+	const std::vector<const Edge<T> *> &CSRGraph<T>::getEdges() const
+	{
+		return edges;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getEdgeFrom() const
+	{
+		return edgeFrom;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getEdgeTo() const
+	{
+		return edgeTo;
+	}
+
+	template <typename T>
+	const std::vector<double> &CSRGraph<T>::getEdgeWeight() const
+	{
+		return edgeWeight;
+	}
+
+	template <typename T>
+	const std::vector<char> &CSRGraph<T>::getEdgeWeighted() const
+	{
+		return edgeWeighted;
+	}
+
+	template <typename T>
+	const std::vector<char> &CSRGraph<T>::getEdgeUndirected() const
+	{
+		return edgeUndirected;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getOutOffset() const
+	{
+		return outOffset;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getOutTarget() const
+	{
+		return outTarget;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getOutEdge() const
+	{
+		return outEdge;
+	}
+
+	template <typename T>
+	const std::vector<double> &CSRGraph<T>::getOutWeight() const
+	{
+		return outWeight;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getInOffset() const
+	{
+		return inOffset;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getInSource() const
+	{
+		return inSource;
+	}
+
+	template <typename T>
+	const std::vector<std::size_t> &CSRGraph<T>::getInEdge() const
+	{
+		return inEdge;
+	}
+
+	template <typename T>
+	const std::vector<double> &CSRGraph<T>::getInWeight() const
+	{
+		return inWeight;
+	}
+
+	template <typename T>
+	std::size_t CSRGraph<T>::getOutDegree(std::size_t index) const
+	{
+		return outOffset[index + 1] - outOffset[index];
+	}
+
+	template <typename T>
+	std::size_t CSRGraph<T>::getInDegree(std::size_t index) const
+	{
+		return inOffset[index + 1] - inOffset[index];
+	}
+
+	template <typename T>
+	bool CSRGraph<T>::isWeighted() const
+	{
+		return weighted;
+	}
+
+	template <typename T>
+	bool CSRGraph<T>::isDirected() const
+	{
+		return directed;
+	}
+
+	template <typename T>
+	bool CSRGraph<T>::isUndirected() const
+	{
+		return undirected;
+	}
+}
+
+#endif // __CXXGRAPH_CSRGRAPH_H__
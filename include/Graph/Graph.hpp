@@ -53,11 +53,30 @@
 #include "Edge/UndirectedEdge.hpp"
 #include "Edge/DirectedWeightedEdge.hpp"
 #include "Edge/UndirectedWeightedEdge.hpp"
+#include "Graph/CSRGraph.hpp"
+#include "Graph/GraphObserver.hpp"
 #include "Utility/ThreadSafe.hpp"
+#include "Utility/ParallelFor.hpp"
+#include "ShortestPath/BlockedFloydWarshall.hpp"
+#include "ShortestPath/CSRBellmanFord.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "ShortestPath/YenKShortestPaths.hpp"
+#include "Traversal/ConcurrentBFS.hpp"
+#include "Traversal/ConnectedComponents.hpp"
+#include "Traversal/DepthFirstSearch.hpp"
+#include "Traversal/DirectionOptimizingBFS.hpp"
+#include "Traversal/EulerianPath.hpp"
+#include "Traversal/GraphSlicing.hpp"
+#include "Traversal/MultiSourceBFS.hpp"
+#include "Traversal/ParallelBoruvka.hpp"
+#include "Traversal/ParallelKahn.hpp"
+#include "Traversal/StronglyConnectedComponents.hpp"
+#include "Traversal/TraversalRange.hpp"
 #include "Utility/Writer.hpp"
 #include "Utility/Reader.hpp"
 #include "Utility/ConstString.hpp"
 #include "Utility/ConstValue.hpp"
+#include "Utility/ExecutionPolicy.hpp"
 #include "Utility/Typedef.hpp"
 #include "Partitioning/Partition.hpp"
 #include "Partitioning/PartitionAlgorithm.hpp"
@@ -92,17 +111,23 @@ namespace CXXGRAPH
 	{
 	private:
 		T_EdgeSet<T> edgeSet = {};
+		unsigned long long version = 0;
+		std::vector<GraphObserver<T> *> observers = {};
 		std::optional<std::pair<std::string, char>> getExtenstionAndSeparator(InputOutputFormat format) const;
 		int writeToStandardFile(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight, InputOutputFormat format) const;
 		int readFromStandardFile(const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight, InputOutputFormat format);
 		void recreateGraphFromReadFiles(std::unordered_map<unsigned long long, std::pair<std::string, std::string>> &edgeMap, std::unordered_map<unsigned long long, bool> &edgeDirectedMap, std::unordered_map<std::string, T> &nodeFeatMap, std::unordered_map<unsigned long long, double> &edgeWeightMap);
 		int compressFile(const std::string &inputFile, const std::string &outputFile) const;
 		int decompressFile(const std::string &inputFile, const std::string &outputFile) const;
+		const DistanceMatrixResult<T> johnsonRows(const std::function<void(const Node<T> *, const std::vector<double> &)> &rowCallback, unsigned int numberOfThreads) const;
 
 	public:
 		Graph() = default;
 		Graph(const T_EdgeSet<T> &edgeSet);
-		virtual ~Graph() = default;
+		// the observers are attached to a single Graph, so they are not copied
+		Graph(const Graph<T> &other);
+		Graph<T> &operator=(const Graph<T> &other);
+		virtual ~Graph();
 		/**
 		 * \brief
 		 * Function that return the Edge set of the Graph
@@ -139,6 +164,51 @@ namespace CXXGRAPH
 		 *
 		 */
 		virtual void removeEdge(unsigned long long edgeId);
+		/**
+		 * \brief
+		 * Function that change the weight of a Weighted Edge of the Graph, increment the
+		 * version and notify the observers. The weight is stored in the Edge, that is owned
+		 * by the caller: every other Graph that contains the Edge sees the new weight without
+		 * being notified, so an Edge whose weight changes must not be shared between Graphs.
+		 * Nothing is done if the Edge is not in the Graph or is not Weighted.
+		 * Note: No Thread Safe
+		 *
+		 * @param edge The Edge to modify
+		 * @param weight The new weight
+		 *
+		 */
+		virtual void setEdgeWeight(Edge<T> &edge, double weight);
+		/**
+		 * \brief
+		 * Function that attach an observer, notified after every modification of the Edge Set
+		 * Note: No Thread Safe
+		 *
+		 * @param observer The observer, it must be detached before it is destroyed. If the Graph
+		 * is destroyed first the observer is notified by onGraphDestroyed and detached
+		 *
+		 */
+		virtual void attachObserver(GraphObserver<T> *observer);
+		/**
+		 * \brief
+		 * Function that detach an observer attached by attachObserver
+		 * Note: No Thread Safe
+		 *
+		 * @param observer The observer
+		 *
+		 */
+		virtual void detachObserver(GraphObserver<T> *observer);
+		/**
+		 * \brief
+		 * Function that return the version of the Graph, incremented every
+		 * time the Edge Set is modified by setEdgeSet, addEdge, removeEdge or setEdgeWeight.
+		 * Results computed on the graph (e.g. by a ShortestPathCache) are
+		 * valid as long as the version does not change.
+		 * Note: No Thread Safe
+		 *
+		 * @returns the current version of the graph
+		 *
+		 */
+		virtual unsigned long long getVersion() const;
 		/**
 		 * \brief
 		 * Function that return the Node Set of the Graph
@@ -187,10 +257,21 @@ namespace CXXGRAPH
 		/**
 		 * @brief This function finds the eulerian path of a directed graph using hierholzers algorithm
 		 *
-		 * @return a vector containing nodes in eulerian path
+		 * @return a vector containing nodes in eulerian path, empty if the graph has no eulerian path
 		 * Note: No Thread Safe
 		 */
 		virtual std::vector<Node<T>> eulerianPath() const;
+		/**
+		 * @brief This function finds an eulerian path (or circuit) with hierholzers algorithm, in time
+		 * linear in the number of edges. The degrees are checked first and the path starts from the
+		 * node with an extra outgoing edge (directed graph) or with odd degree (undirected graph).
+		 * 	Applicable for Directed Graph or Undirected Graph, not for a mix of the two
+		 *
+		 * @return a struct with the nodes and the edges of the path, else ERROR in case of mixed graph,
+		 * degrees that do not allow an eulerian path or edges that are not connected
+		 * Note: No Thread Safe
+		 */
+		virtual EulerianPathResult<T> hierholzer() const;
 		/**
 		 * @brief Function runs the dijkstra algorithm for some source node and
 		 * target node in the graph and returns the shortest distance of target
@@ -210,22 +291,144 @@ namespace CXXGRAPH
 		 * from the source. It can also detect if a negative cycle exists in the graph.
 		 * Note: No Thread Safe
 		 *
+		 * The relaxation is queue based (SPFA): every round only relaxes the out edges of the
+		 * nodes improved in the previous round. The rounds that touch a large part of the edges
+		 * are relaxed in parallel by numberOfThreads threads.
+		 *
 		 * @param source source vertex
 		 * @param target target vertex
+		 * @param numberOfThreads number of threads used by the dense rounds (1 = sequential)
 		 *
 		 * @return shortest distance if target is reachable from source else ERROR in
 		 * case if target is not reachable from source. If there is no error then also
 		 * returns if the graph contains a negative cycle.
 		 */
-		virtual const BellmanFordResult bellmanford(const Node<T> &source, const Node<T> &target) const;
+		virtual const BellmanFordResult bellmanford(const Node<T> &source, const Node<T> &target, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function runs bellmanford with the threads of an execution policy
+		 *
+		 * @param source source vertex
+		 * @param target target vertex
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const BellmanFordResult bellmanford(const Node<T> &source, const Node<T> &target, const ExecutionPolicy &policy) const;
 		/**
 		 * @brief Function runs the floyd-warshall algorithm and returns the shortest distance of
 		 * all pair of nodes. It can also detect if a negative cycle exists in the graph.
+		 * An undirected edge can be walked in both directions, between parallel edges the lightest
+		 * one is used and a self loop only counts when it is negative, as a negative cycle.
 		 * Note: No Thread Safe
 		 * @return a map whose keys are node ids and values are the shortest distance. If there is no error then also
 		 * returns if the graph contains a negative cycle.
 		 */
 		virtual const FWResult floydWarshall() const;
+		/**
+		 * @brief Function runs the floyd-warshall algorithm on a dense matrix indexed by the nodes.
+		 * The matrix is processed in cache sized blocks and the independent blocks are distributed
+		 * between numberOfThreads threads. It can also detect if a negative cycle exists in the graph.
+		 * The edges are read as in floydWarshall().
+		 * Note: No Thread Safe
+		 *
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return the matrix of distances, rows and columns are the nodes in the order of getNodeSet().
+		 * If there is no error then also returns if the graph contains a negative cycle.
+		 */
+		virtual const DistanceMatrixResult<T> floydWarshallMatrix(unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function runs floydWarshallMatrix with the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const DistanceMatrixResult<T> floydWarshallMatrix(const ExecutionPolicy &policy) const;
+		/**
+		 * @brief Function runs the johnson algorithm and returns the shortest distance of all pair of nodes.
+		 * A single bellman-ford from a virtual node connected to every node gives the potentials that make
+		 * all the weights non negative, then a dijkstra runs from every node; the sources are distributed
+		 * between numberOfThreads threads. It can also detect if a negative cycle exists in the graph.
+		 * The edges are read as in floydWarshall().
+		 * Note: No Thread Safe
+		 *
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return the matrix of distances, rows and columns are the nodes in the order of getNodeSet().
+		 * If there is no error then also returns if the graph contains a negative cycle.
+		 */
+		virtual const DistanceMatrixResult<T> johnson(unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function runs johnson with the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const DistanceMatrixResult<T> johnson(const ExecutionPolicy &policy) const;
+		/**
+		 * @brief Function runs the johnson algorithm without storing the matrix of distances: every row
+		 * is passed to rowCallback(source, distances) as soon as it is computed, with the distances in
+		 * the order of the columnNodes of the result. The calls of rowCallback are serialized, the order
+		 * of the rows is not defined when numberOfThreads is greater than 1.
+		 * Note: No Thread Safe
+		 *
+		 * @param rowCallback function that receive the distances from a source to all the nodes
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return the result with the nodes and no distances. If there is no error then also returns if
+		 * the graph contains a negative cycle, in that case rowCallback is never called.
+		 */
+		virtual const DistanceMatrixResult<T> johnson(const std::function<void(const Node<T> *, const std::vector<double> &)> &rowCallback, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function runs johnson with a callback for every row and the threads of an execution policy
+		 *
+		 * @param rowCallback function that receive the distances from a source to all the nodes
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const DistanceMatrixResult<T> johnson(const std::function<void(const Node<T> *, const std::vector<double> &)> &rowCallback, const ExecutionPolicy &policy) const;
+		/**
+		 * @brief Function runs the Yen's algorithm and returns the k shortest loopless paths from
+		 * source to target. The deviations of every path are searched on a single CSR copy of the
+		 * graph masking nodes and edges, and are distributed between numberOfThreads threads.
+		 * Note: No Thread Safe
+		 *
+		 * @param source source vertex
+		 * @param target target vertex
+		 * @param k maximum number of paths
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return the ids of the edges and the cost of at most k paths, in order of cost, else ERROR
+		 * in case if target is not reachable from source or the weights are not valid.
+		 */
+		virtual const KShortestPathsResult kShortestPaths(const Node<T> &source, const Node<T> &target, std::size_t k, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function runs the Yen's algorithm with the threads of an execution policy
+		 *
+		 * @param source source vertex
+		 * @param target target vertex
+		 * @param k maximum number of paths
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const KShortestPathsResult kShortestPaths(const Node<T> &source, const Node<T> &target, std::size_t k, const ExecutionPolicy &policy) const;
+		/**
+		 * @brief Function that compute the shortest distance between every source and every target.
+		 * A dijkstra runs from every source and the distances of the targets are copied in a row of
+		 * the result; the sources are distributed between numberOfThreads threads. When many queries
+		 * run on the same graph, ContractionHierarchy::manyToMany is faster.
+		 * Note: No Thread Safe
+		 *
+		 * @param sources nodes of the rows
+		 * @param targets nodes of the columns
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return the row-major matrix of distances, INF_DOUBLE for the pairs not connected
+		 */
+		virtual const DistanceMatrixResult<T> manyToMany(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function that compute the distance table with the threads of an execution policy
+		 *
+		 * @param sources nodes of the rows
+		 * @param targets nodes of the columns
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const DistanceMatrixResult<T> manyToMany(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, const ExecutionPolicy &policy) const;
 		/**
 		 * @brief Function runs the prim algorithm and returns the minimum spanning tree
 		 * if the graph is undirected.
@@ -235,15 +438,28 @@ namespace CXXGRAPH
 		virtual const MstResult prim() const;
 		/**
 		 * @brief Function runs the boruvka algorithm and returns the minimum spanning tree & cost
-		 * if the graph is undirected.
+		 * if the graph is undirected. The rounds run on the edge arrays of the CSR of the graph:
+		 * the cheapest edge of every component is selected with atomic compare and swap, the
+		 * components are hooked in a concurrent union-find and the edges inside a component are
+		 * dropped before the next round; every phase is split between numberOfThreads threads.
+		 * If the graph is not connected the result is the minimum spanning forest.
 		 * Note: No Thread Safe
+		 * @param numberOfThreads number of threads (1 = sequential)
 		 * @return struct of type MstResult with following fields
 		 * success: true if algorithm completed successfully ELSE false
-		 * mst: vector containing id of nodes in minimum spanning tree & cost of MST
+		 * mst: vector containing id of nodes in minimum spanning tree & cost of MST, in order of
+		 * the edges of the CSR, the same for any number of threads
 		 * mstCost: Cost of MST
 		 * errorMessage: "" if no error ELSE report the encountered error
 		 */
-		virtual const MstResult boruvka() const;
+		virtual const MstResult boruvka(unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function runs the boruvka algorithm with the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const MstResult boruvka(const ExecutionPolicy &policy) const;
 		/**
 		 * @brief Function runs the kruskal algorithm and returns the minimum spanning tree
 		 * if the graph is undirected.
@@ -280,18 +496,92 @@ namespace CXXGRAPH
 		 *
 		 */
 		virtual const std::vector<Node<T>> breadth_first_search(const Node<T> &start) const;
+		/**
+		 * @brief Function performs the breadth first search with an execution policy: the sequential policy runs breadth_first_search, the parallel ones concurrency_breadth_first_search
+		 *
+		 * @param start Node from where traversing starts
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return a vector of Node indicating which Node were visited during the search
+		 */
+		virtual const std::vector<Node<T>> breadth_first_search(const Node<T> &start, const ExecutionPolicy &policy) const;
         /**
 		 * \brief
 		 * The multithreaded version of breadth_first_search
          * It turns out to be two indepentent functions because of implemntation differences
+		 * The levels are expanded in parallel on the CSR snapshot of the graph, the visited set
+		 * is an atomic bitmap, so the threads do not take any lock.
 		 *
 		 * @param start Node from where traversing starts
          * @param num_threads number of threads
 		 * @returns a vector of Node indicating which Node were visited during the
-		 * search.
+		 * search, level by level.
 		 *
 		 */
 		virtual const std::vector<Node<T>> concurrency_breadth_first_search(const Node<T> &start, size_t num_threads) const;
+		/**
+		 * \brief
+		 * Function performs a direction-optimizing breadth first search over the graph:
+		 * the small levels are expanded top-down from the frontier, the large ones bottom-up,
+		 * with every unvisited node looking for a parent in the frontier through its incoming edges.
+		 * Note: No Thread Safe
+		 *
+		 * @param start Node from where traversing starts
+		 * @param numberOfThreads number of threads that expand every level (1 = sequential)
+		 * @returns the reached nodes in order of depth, with their depth and parent
+		 *
+		 */
+		virtual const BFSTreeResult<T> direction_optimizing_breadth_first_search(const Node<T> &start, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function performs a direction-optimizing breadth first search with the threads of an execution policy
+		 *
+		 * @param start Node from where traversing starts
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const BFSTreeResult<T> direction_optimizing_breadth_first_search(const Node<T> &start, const ExecutionPolicy &policy) const;
+		/**
+		 * \brief
+		 * Function performs the breadth first searches from all the sources together, with a
+		 * bit-parallel search that expands up to 512 sources with a single scan of the edges.
+		 * Note: No Thread Safe
+		 *
+		 * @param sources nodes from where the searches start (rows)
+		 * @param targets nodes whose depth is returned (columns)
+		 * @param numberOfThreads number of threads that run the batches of sources (1 = sequential)
+		 * @returns the row-major matrix of the number of edges from every source to every target,
+		 * INF_DOUBLE for the targets not reachable
+		 *
+		 */
+		virtual const DistanceMatrixResult<T> multi_source_breadth_first_search(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function performs the breadth first searches from all the sources with the threads of an execution policy
+		 *
+		 * @param sources nodes from where the searches start (rows)
+		 * @param targets nodes whose depth is returned (columns)
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const DistanceMatrixResult<T> multi_source_breadth_first_search(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, const ExecutionPolicy &policy) const;
+		/**
+		 * \brief
+		 * Function counts the nodes reachable from every source and the sum of their depths,
+		 * with the same bit-parallel search of multi_source_breadth_first_search.
+		 * Note: No Thread Safe
+		 *
+		 * @param sources nodes from where the searches start
+		 * @param numberOfThreads number of threads that run the batches of sources (1 = sequential)
+		 * @returns the number of reachable nodes and the sum of the depths for every source
+		 *
+		 */
+		virtual const ReachabilityResult<T> multi_source_reachability(const std::vector<const Node<T> *> &sources, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief Function counts the nodes reachable from every source with the threads of an execution policy
+		 *
+		 * @param sources nodes from where the searches start
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const ReachabilityResult<T> multi_source_reachability(const std::vector<const Node<T> *> &sources, const ExecutionPolicy &policy) const;
 		/**
 		 * \brief
 		 * Function performs the depth first search algorithm over the graph
@@ -303,6 +593,28 @@ namespace CXXGRAPH
 		 *
 		 */
 		virtual const std::vector<Node<T>> depth_first_search(const Node<T> &start) const;
+		/**
+		 * \brief
+		 * Function returns a lazy breadth first traversal of the graph: the nodes are visited
+		 * while the range is iterated, with their depth and parent, and leaving the loop stops
+		 * the traversal. The range works on a snapshot of the graph taken by this call.
+		 * Note: No Thread Safe
+		 *
+		 * @param start Node from where traversing starts
+		 * @returns a single pass range of TraversalStep, empty if start is not in the graph
+		 *
+		 */
+		virtual TRAVERSAL::BreadthFirstRange<T> breadth_first_range(const Node<T> &start) const;
+		/**
+		 * \brief
+		 * Function returns a lazy depth first traversal (pre-order) of the graph, as breadth_first_range.
+		 * Note: No Thread Safe
+		 *
+		 * @param start Node from where traversing starts
+		 * @returns a single pass range of TraversalStep, empty if start is not in the graph
+		 *
+		 */
+		virtual TRAVERSAL::DepthFirstRange<T> depth_first_range(const Node<T> &start) const;
 
 		/**
 		 * \brief
@@ -367,6 +679,32 @@ namespace CXXGRAPH
 		 * @return false otherwise
 		 */
 		virtual bool isConnectedGraph() const;
+		/**
+		 * @brief This function checks if the graph is connected, finding the components with the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of isConnectedGraph()
+		 */
+		virtual bool isConnectedGraph(const ExecutionPolicy &policy) const;
+
+		/**
+		 * @brief This function finds the connected components of the graph with the parallel
+		 * Afforest algorithm, a lock-free union-find that links a few edges of every node, estimates
+		 * the largest component and links the other edges only for the nodes outside of it.
+		 * 	The direction of the edges is ignored, so in a Directed Graph the components are the
+		 * 	weakly connected ones.
+		 *
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return the component of every node, the components are numbered in order of their first node
+		 */
+		virtual ComponentLabelResult<T> connectedComponents(unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief This function finds the connected components of the graph with the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual ComponentLabelResult<T> connectedComponents(const ExecutionPolicy &policy) const;
 
 		/**
 		 * @brief This function checks if the graph is strongly connected or not
@@ -394,6 +732,32 @@ namespace CXXGRAPH
 		 * of undirected or cyclic graph
 		 */
 		virtual TopoSortResult<T> kahn() const;
+		/**
+		 * @brief This function sort nodes in topological order using kahn's algorithm with the threads of an execution policy: every level of the order is processed in parallel
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same order of kahn() with the sequential policy, otherwise a topological order with the levels in the same order
+		 */
+		virtual TopoSortResult<T> kahn(const ExecutionPolicy &policy) const;
+
+		/**
+		 * @brief This function sort nodes in topological order with a level synchronous parallel
+		 * kahn's algorithm: the nodes of every level are the ones whose in-degree reaches zero
+		 * when the previous level is removed, they are processed in parallel with atomic in-degrees.
+		 * 	Applicable for Directed Acyclic Graph
+		 *
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return a struct with the Nodes ordered topologically and the level of every node, that
+		 * does not depend on the number of threads, else ERROR in case of undirected or cyclic graph
+		 */
+		virtual TopoLevelResult<T> topologicalLevels(unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief This function sort nodes in topological levels with the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual TopoLevelResult<T> topologicalLevels(const ExecutionPolicy &policy) const;
 
 		/**
 		* \brief
@@ -407,6 +771,45 @@ namespace CXXGRAPH
 		*/
 		virtual SCCResult<T> kosaraju() const;
 
+		/**
+		* \brief
+		* This function finds the strongly connected components of the graph with an iterative
+		* Tarjan search, in time linear in the size of the graph.
+		*
+		* Note: No Thread Safe
+		* @return the component of every node, the components are numbered in reverse
+		* topological order of the condensation; ERROR in case of undirected graph
+		*/
+		virtual ComponentLabelResult<T> tarjan() const;
+		/**
+		 * @brief This function finds the strongly connected components with an execution policy: the sequential policy runs tarjan, the parallel ones forward_backward_scc
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the component of every node; ERROR in case of undirected graph
+		 */
+		virtual ComponentLabelResult<T> tarjan(const ExecutionPolicy &policy) const;
+
+		/**
+		* \brief
+		* This function finds the strongly connected components of the graph in parallel with the
+		* forward-backward algorithm: the nodes without incoming or outgoing edges are trimmed, then
+		* every subproblem is split by a forward and a backward search from a pivot, and the small
+		* subproblems are solved with Tarjan searches in parallel.
+		*
+		* Note: No Thread Safe
+		* @param numberOfThreads number of threads (1 = sequential)
+		* @return the component of every node, the ids are a labelling without order;
+		* ERROR in case of undirected graph
+		*/
+		virtual ComponentLabelResult<T> forward_backward_scc(unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief This function finds the strongly connected components with the forward-backward algorithm and the threads of an execution policy
+		 *
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual ComponentLabelResult<T> forward_backward_scc(const ExecutionPolicy &policy) const;
+
 		/**
 		* \brief
 		* This function performs Graph Slicing based on connectivity
@@ -418,12 +821,24 @@ namespace CXXGRAPH
 		* from n, and let C' be its complement. There's a third set M, which is the
 		* non-strict subset of C containing all nodes that are reachable from any node in C'.
 		* The problem consists of finding all nodes that belong to C but not to M.
+		* C is found with a traversal from n and M with a single traversal from all the nodes of C',
+		* so the time is linear in the size of the graph.
 
 		* Note: No Thread Safe
 		* @param start Node from where traversing starts
+		* @param numberOfThreads number of threads of the traversals (1 = sequential, the nodes are
+		* in depth first order, otherwise in breadth first order)
 		* @return a vector of nodes that belong to C but not to M.
 		*/
-		virtual const std::vector<Node<T>> graph_slicing(const Node<T> &start) const;
+		virtual const std::vector<Node<T>> graph_slicing(const Node<T> &start, unsigned int numberOfThreads = 1) const;
+		/**
+		 * @brief This function performs Graph Slicing with the threads of an execution policy
+		 *
+		 * @param start Node from where traversing starts
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfThreads
+		 */
+		virtual const std::vector<Node<T>> graph_slicing(const Node<T> &start, const ExecutionPolicy &policy) const;
 
 		/**
 		 * \brief
@@ -442,11 +857,12 @@ namespace CXXGRAPH
 		/**
 		 * @brief Function runs the Dial algorithm  (Optimized Dijkstra for small range weights) for some source node and
 		 * target node in the graph and returns the shortest distance of target
-		 * from the source.
+		 * from the source. The weights are truncated to integers and the nodes are kept
+		 * in maxWeight + 1 circular buckets.
 		 * Note: No Thread Safe
 		 *
 		 * @param source source vertex
-		 * @param maxWeight maximum weight of the edge
+		 * @param maxWeight maximum weight of the edge (a heavier edge only enlarges the buckets)
 		 *
 		 * @return shortest distance for all nodes reachable from source else ERROR in
 		 * case there is error in the computation.
@@ -503,6 +919,15 @@ namespace CXXGRAPH
 		 * @return The partiton Map of the partitioned graph
 		 */
 		virtual PartitionMap<T> partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions, double param1 = 0.0, double param2 = 0.0, double param3 = 0.0, unsigned int numberOfthreads = std::thread::hardware_concurrency()) const;
+		/**
+		 * @brief This function partition the graph with the threads of an execution policy
+		 *
+		 * @param algorithm Partition Algorithm
+		 * @param numberOfPartitions number of partitions
+		 * @param policy execution context: sequential, parallel with a number of threads or on a pool
+		 * @return the same result of the overload with numberOfthreads
+		 */
+		virtual PartitionMap<T> partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions, const ExecutionPolicy &policy, double param1 = 0.0, double param2 = 0.0, double param3 = 0.0) const;
 
 		friend std::ostream &operator<<<>(std::ostream &os, const Graph<T> &graph);
 		friend std::ostream &operator<<<>(std::ostream &os, const AdjacencyMatrix<T> &adj);
@@ -524,6 +949,37 @@ namespace CXXGRAPH
 		}
 	}
 
+	template <typename T>
+	Graph<T>::Graph(const Graph<T> &other) : edgeSet(other.edgeSet), version(other.version)
+	{
+	}
+
+	template <typename T>
+	Graph<T>::~Graph()
+	{
+		// the observers are told that they must not use the Graph anymore
+		auto attached = std::move(observers);
+		for (auto observer : attached)
+		{
+			observer->onGraphDestroyed();
+		}
+	}
+
+	template <typename T>
+	Graph<T> &Graph<T>::operator=(const Graph<T> &other)
+	{
+		if (this != &other)
+		{
+			edgeSet = other.edgeSet;
+			++version;
+			for (auto observer : observers)
+			{
+				observer->onEdgeSetChanged();
+			}
+		}
+		return *this;
+	}
+
 	template <typename T>
 	const T_EdgeSet<T> &Graph<T>::getEdgeSet() const
 	{
@@ -545,6 +1001,11 @@ namespace CXXGRAPH
 			*/
 			this->edgeSet.insert(edgeSetIt);
 		}
+		++version;
+		for (auto observer : observers)
+		{
+			observer->onEdgeSetChanged();
+		}
 	}
 
 	template <typename T>
@@ -557,7 +1018,14 @@ namespace CXXGRAPH
 			edgeSet.insert(edge);
 		}
 		*/
-		edgeSet.insert(edge);
+		if (edgeSet.insert(edge).second)
+		{
+			++version;
+			for (auto observer : observers)
+			{
+				observer->onEdgeAdded(edge);
+			}
+		}
 	}
 
 	template <typename T>
@@ -571,9 +1039,52 @@ namespace CXXGRAPH
 									   { return (*(edgeOpt.value()) == *edge); }));
 			*/
 			edgeSet.erase(edgeSet.find(edgeOpt.value()));
+			++version;
+			for (auto observer : observers)
+			{
+				observer->onEdgeRemoved(edgeOpt.value());
+			}
+		}
+	}
+
+	template <typename T>
+	void Graph<T>::setEdgeWeight(Edge<T> &edge, double weight)
+	{
+		if (edgeSet.find(&edge) == edgeSet.end() || !edge.isWeighted().has_value() || !edge.isWeighted().value())
+		{
+			return;
+		}
+		auto weighted = dynamic_cast<Weighted *>(&edge);
+		auto oldWeight = weighted->getWeight();
+		weighted->setWeight(weight);
+		++version;
+		for (auto observer : observers)
+		{
+			observer->onEdgeWeightChanged(&edge, oldWeight);
 		}
 	}
 
+	template <typename T>
+	void Graph<T>::attachObserver(GraphObserver<T> *observer)
+	{
+		if (std::find(observers.begin(), observers.end(), observer) == observers.end())
+		{
+			observers.push_back(observer);
+		}
+	}
+
+	template <typename T>
+	void Graph<T>::detachObserver(GraphObserver<T> *observer)
+	{
+		observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+	}
+
+	template <typename T>
+	unsigned long long Graph<T>::getVersion() const
+	{
+		return version;
+	}
+
 	template <typename T>
 	const std::set<const Node<T> *> Graph<T>::getNodeSet() const
 	{
@@ -988,35 +1499,60 @@ namespace CXXGRAPH
 	template <typename T>
 	std::vector<Node<T>> Graph<T>::eulerianPath() const
 	{
-		const auto nodeSet = Graph<T>::getNodeSet();
-		auto adj = Graph<T>::getAdjMatrix();
 		std::vector<Node<T>> eulerPath;
-		std::vector<const Node<T> *> currentPath;
-		auto currentNode = *(nodeSet.begin());
-		currentPath.push_back(currentNode);
-		while (currentPath.size() > 0)
-		{
-			auto &edges = adj.at(currentNode);
-			// we keep removing the edges that
-			// have been traversed from the adjacency list
-			if (edges.size())
-			{
-				auto firstEdge = edges.back().second;
-				auto nextNodeId = firstEdge->getNodePair().second;
-				currentPath.push_back(nextNodeId);
-				currentNode = nextNodeId;
-				edges.pop_back();
-			}
-			else
-			{
-				eulerPath.push_back(*currentNode);
-				currentNode = currentPath.back();
-				currentPath.pop_back();
-			}
+		auto result = hierholzer();
+		eulerPath.reserve(result.nodes.size());
+		for (auto node : result.nodes)
+		{
+			eulerPath.push_back(*node);
 		}
 		return eulerPath;
 	}
 
+	template <typename T>
+	EulerianPathResult<T> Graph<T>::hierholzer() const
+	{
+		EulerianPathResult<T> result;
+		const CSRGraph<T> csr(getEdgeSet());
+		const auto &edgeUndirected = csr.getEdgeUndirected();
+		if (!csr.isDirected() && !std::all_of(edgeUndirected.begin(), edgeUndirected.end(), [](char undirected)
+											   { return undirected != 0; }))
+		{
+			result.errorMessage = ERR_MIXED_GRAPH;
+			return result;
+		}
+		bool circuit = false;
+		auto start = TRAVERSAL::csrEulerianStart(csr.getOutOffset(), csr.getInOffset(), csr.isDirected(), circuit);
+		if (!start.has_value())
+		{
+			// an empty graph is an empty circuit
+			result.success = csr.getNumberOfEdges() == 0;
+			result.isCircuit = result.success;
+			result.errorMessage = result.success ? "" : ERR_NO_EULERIAN_PATH;
+			return result;
+		}
+		std::vector<std::size_t> nodePath;
+		std::vector<std::size_t> edgePath;
+		if (!TRAVERSAL::csrHierholzer(csr.getOutOffset(), csr.getOutTarget(), csr.getOutEdge(), csr.getNumberOfEdges(), start.value(), nodePath, edgePath))
+		{
+			result.errorMessage = ERR_NO_EULERIAN_PATH;
+			return result;
+		}
+		result.nodes.reserve(nodePath.size());
+		for (auto node : nodePath)
+		{
+			result.nodes.push_back(csr.getNode(node));
+		}
+		result.edges.reserve(edgePath.size());
+		for (auto edge : edgePath)
+		{
+			result.edges.push_back(csr.getEdges()[edge]);
+		}
+		result.isCircuit = circuit;
+		result.success = true;
+		return result;
+	}
+
 	template <typename T>
 	const AdjacencyMatrix<T> Graph<T>::getAdjMatrix() const
 	{
@@ -1165,106 +1701,55 @@ namespace CXXGRAPH
 	}
 
 	template <typename T>
-	const BellmanFordResult Graph<T>::bellmanford(const Node<T> &source, const Node<T> &target) const
+	const BellmanFordResult Graph<T>::bellmanford(const Node<T> &source, const Node<T> &target, unsigned int numberOfThreads) const
 	{
 		BellmanFordResult result;
 		result.success = false;
 		result.errorMessage = "";
 		result.result = INF_DOUBLE;
-		auto nodeSet = Graph<T>::getNodeSet();
-		if (std::find(nodeSet.begin(), nodeSet.end(), &source) == nodeSet.end())
+		const CSRGraph<T> csr(getEdgeSet());
+		auto sourceIndex = csr.getIndex(&source);
+		if (!sourceIndex.has_value())
 		{
 			// check if source node exist in the graph
 			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
 			return result;
 		}
-		if (std::find(nodeSet.begin(), nodeSet.end(), &target) == nodeSet.end())
+		auto targetIndex = csr.getIndex(&target);
+		if (!targetIndex.has_value())
 		{
 			// check if target node exist in the graph
 			result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
 			return result;
 		}
-		// setting all the distances initially to INF_DOUBLE
-		std::unordered_map<const Node<T> *, double> dist, currentDist;
-		// n denotes the number of vertices in graph
-		auto n = nodeSet.size();
-		for (const auto &elem : nodeSet)
+		if (!csr.isWeighted())
 		{
-			dist[elem] = INF_DOUBLE;
-			currentDist[elem] = INF_DOUBLE;
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
 		}
 
+		// setting all the distances initially to INF_DOUBLE
+		std::vector<double> dist(csr.getNumberOfNodes(), INF_DOUBLE);
 		// marking the distance of source as 0
-		dist[&source] = 0;
-		// set if node distances in two consecutive
-		// iterations remain the same.
-		auto earlyStopping = false;
-		// outer loop for vertex relaxation
-		for (int i = 0; i < n - 1; ++i)
-		{
-			auto edgeSet = Graph<T>::getEdgeSet();
-			// inner loop for distance updates of
-			// each relaxation
-			for (const auto &edge : edgeSet)
-			{
-				auto elem = edge->getNodePair();
-				if (edge->isWeighted().has_value() && edge->isWeighted().value())
-				{
-					auto edge_weight = (dynamic_cast<const Weighted *>(edge))->getWeight();
-					if (dist[elem.first] + edge_weight < dist[elem.second])
-						dist[elem.second] = dist[elem.first] + edge_weight;
-				}
-				else
-				{
-					// No Weighted Edge
-					result.errorMessage = ERR_NO_WEIGHTED_EDGE;
-					return result;
-				}
-			}
-			auto flag = true;
-			for (const auto &[key, value] : dist)
-			{
-				if (currentDist[key] != value)
-				{
-					flag = false;
-					break;
-				}
-			}
-			for (const auto &[key, value] : dist)
-			{
-				currentDist[key] = value; // update the current distance
-			}
-			if (flag)
-			{
-				earlyStopping = true;
-				break;
-			}
-		}
+		dist[sourceIndex.value()] = 0;
+		auto negativeCycle = SHORTESTPATH::csrBellmanFord(csr, dist, {sourceIndex.value()}, numberOfThreads);
 
 		// check if there exists a negative cycle
-		if (!earlyStopping)
+		if (negativeCycle)
 		{
-			auto edgeSet = Graph<T>::getEdgeSet();
-			for (const auto &edge : edgeSet)
-			{
-				auto elem = edge->getNodePair();
-				auto edge_weight = (dynamic_cast<const Weighted *>(edge))->getWeight();
-				if (dist[elem.first] + edge_weight < dist[elem.second])
-				{
-					result.success = true;
-					result.negativeCycle = true;
-					result.errorMessage = "";
-					return result;
-				}
-			}
+			result.success = true;
+			result.negativeCycle = true;
+			result.errorMessage = "";
+			return result;
 		}
 
-		if (dist[&target] != INF_DOUBLE)
+		if (dist[targetIndex.value()] != INF_DOUBLE)
 		{
 			result.success = true;
 			result.errorMessage = "";
 			result.negativeCycle = false;
-			result.result = dist[&target];
+			result.result = dist[targetIndex.value()];
 			return result;
 		}
 		result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
@@ -1272,86 +1757,327 @@ namespace CXXGRAPH
 		return result;
 	}
 
+	template <typename T>
+	const BellmanFordResult Graph<T>::bellmanford(const Node<T> &source, const Node<T> &target, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return bellmanford(source, target, policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	const FWResult Graph<T>::floydWarshall() const
 	{
-		FWResult result;
+		return floydWarshallMatrix().toFWResult();
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::floydWarshallMatrix(unsigned int numberOfThreads) const
+	{
+		DistanceMatrixResult<T> result;
 		result.success = false;
 		result.errorMessage = "";
-		std::unordered_map<std::pair<std::string, std::string>, double, CXXGRAPH::pair_hash> pairwise_dist;
-		const auto &nodeSet = Graph<T>::getNodeSet();
+		const CSRGraph<T> csr(getEdgeSet());
+		if (!csr.isWeighted())
+		{
+			// if an edge exists but has no weight associated
+			// with it, we return an error message
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
+		}
+		const auto n = csr.getNumberOfNodes();
+		const auto &outOffset = csr.getOutOffset();
+		const auto &outTarget = csr.getOutTarget();
+		const auto &outWeight = csr.getOutWeight();
 		// create a pairwise distance matrix with distance node distances
 		// set to inf. Distance of node to itself is set as 0.
-		for (const auto &elem1 : nodeSet)
+		auto &dist = result.distances;
+		dist.assign(n * n, INF_DOUBLE);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			dist[i * n + i] = 0.0;
+		}
+		// update the weights of nodes
+		// connected by edges
+		for (std::size_t i = 0; i < n; ++i)
 		{
-			for (const auto &elem2 : nodeSet)
+			for (auto arc = outOffset[i]; arc < outOffset[i + 1]; ++arc)
 			{
-				auto key = std::make_pair(elem1->getUserId(), elem2->getUserId());
-				if (elem1 != elem2)
-					pairwise_dist[key] = INF_DOUBLE;
-				else
-					pairwise_dist[key] = 0.0;
+				auto &elem = dist[i * n + outTarget[arc]];
+				elem = std::min(elem, outWeight[arc]);
 			}
 		}
 
-		const auto &edgeSet = Graph<T>::getEdgeSet();
-		// update the weights of nodes
-		// connected by edges
-		for (const auto &edge : edgeSet)
+		SHORTESTPATH::blockedFloydWarshall(dist, n, numberOfThreads);
+
+		result.success = true;
+		result.rowNodes = csr.getNodes();
+		result.columnNodes = csr.getNodes();
+		// presense of negative number in the diagonal indicates
+		// that that the graph contains a negative cycle
+		for (std::size_t i = 0; i < n; ++i)
 		{
-			const auto &elem = edge->getNodePair();
-			if (edge->isWeighted().has_value() && edge->isWeighted().value())
+			if (dist[i * n + i] < 0.)
 			{
-				auto edgeWeight = (dynamic_cast<const Weighted *>(edge))->getWeight();
-				auto key = std::make_pair(elem.first->getUserId(), elem.second->getUserId());
-				pairwise_dist[key] = edgeWeight;
+				result.negativeCycle = true;
+				break;
 			}
-			else
+		}
+		return result;
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::floydWarshallMatrix(const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return floydWarshallMatrix(policy.getNumberOfThreads()); });
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::johnsonRows(const std::function<void(const Node<T> *, const std::vector<double> &)> &rowCallback, unsigned int numberOfThreads) const
+	{
+		DistanceMatrixResult<T> result;
+		result.success = false;
+		result.errorMessage = "";
+		const CSRGraph<T> csr(getEdgeSet());
+		if (!csr.isWeighted())
+		{
+			// if an edge exists but has no weight associated
+			// with it, we return an error message
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
+		}
+		const auto n = csr.getNumberOfNodes();
+		result.rowNodes = csr.getNodes();
+		result.columnNodes = csr.getNodes();
+
+		// the virtual node has a zero weighted edge to every node, so all the nodes start at distance 0
+		std::vector<double> potential(n, 0.0);
+		std::vector<std::size_t> allNodes(n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			allNodes[i] = i;
+		}
+		if (SHORTESTPATH::csrBellmanFord(csr, potential, std::move(allNodes), numberOfThreads))
+		{
+			result.success = true;
+			result.negativeCycle = true;
+			return result;
+		}
+
+		// w'(u, v) = w(u, v) + h(u) - h(v) is non negative and keeps the same shortest paths
+		const auto &outOffset = csr.getOutOffset();
+		const auto &outTarget = csr.getOutTarget();
+		const auto &outWeight = csr.getOutWeight();
+		std::vector<double> reweighted(outWeight.size());
+		for (std::size_t u = 0; u < n; ++u)
+		{
+			for (auto arc = outOffset[u]; arc < outOffset[u + 1]; ++arc)
 			{
-				// if an edge exists but has no weight associated
-				// with it, we return an error message
-				result.errorMessage = ERR_NO_WEIGHTED_EDGE;
-				return result;
+				reweighted[arc] = std::max(0.0, outWeight[arc] + potential[u] - potential[outTarget[arc]]);
 			}
 		}
 
-		for (const auto &k : nodeSet)
+		// without callback the rows are stored in the matrix, every thread writes only the rows of its sources
+		if (!rowCallback)
+		{
+			result.distances.assign(n * n, INF_DOUBLE);
+		}
+		std::mutex callbackMutex;
+		parallelFor(0, n, numberOfThreads, 1, [&](std::size_t begin, std::size_t end, unsigned int)
 		{
-			// set all vertices as source one by one
-			for (const auto &src : nodeSet)
+			std::vector<double> dist;
+			for (auto source = begin; source < end; ++source)
 			{
-				// iterate through all vertices as destination for the
-				// current source
-				auto src_k = std::make_pair(src->getUserId(), k->getUserId());
-				for (const auto &dst : nodeSet)
+				SHORTESTPATH::csrDijkstra(outOffset, outTarget, reweighted, source, dist);
+				for (std::size_t target = 0; target < n; ++target)
 				{
-					// If vertex k provides a shorter path than
-					// src to dst, update the value of
-					// pairwise_dist[src_to_dst]
-					auto src_dst = std::make_pair(src->getUserId(), dst->getUserId());
-					auto k_dst = std::make_pair(k->getUserId(), dst->getUserId());
-					if (pairwise_dist[src_dst] > (pairwise_dist[src_k] + pairwise_dist[k_dst]) && (pairwise_dist[k_dst] != INF_DOUBLE && pairwise_dist[src_k] != INF_DOUBLE))
-						pairwise_dist[src_dst] = pairwise_dist[src_k] + pairwise_dist[k_dst];
+					if (dist[target] != INF_DOUBLE)
+					{
+						dist[target] += potential[target] - potential[source];
+					}
 				}
+				if (rowCallback)
+				{
+					std::lock_guard<std::mutex> lock(callbackMutex);
+					rowCallback(csr.getNode(source), dist);
+				}
+				else
+				{
+					std::copy(dist.begin(), dist.end(), result.distances.begin() + source * n);
+				}
+			}
+		});
+		result.success = true;
+		return result;
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::johnson(unsigned int numberOfThreads) const
+	{
+		return johnsonRows(nullptr, numberOfThreads);
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::johnson(const std::function<void(const Node<T> *, const std::vector<double> &)> &rowCallback, unsigned int numberOfThreads) const
+	{
+		return johnsonRows(rowCallback, numberOfThreads);
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::johnson(const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return johnson(policy.getNumberOfThreads()); });
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::johnson(const std::function<void(const Node<T> *, const std::vector<double> &)> &rowCallback, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return johnson(rowCallback, policy.getNumberOfThreads()); });
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::manyToMany(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads) const
+	{
+		DistanceMatrixResult<T> result;
+		result.success = false;
+		result.errorMessage = "";
+		const CSRGraph<T> csr(getEdgeSet());
+		std::vector<std::size_t> sourceIndex, targetIndex;
+		for (const auto &source : sources)
+		{
+			auto index = csr.getIndex(source);
+			if (!index.has_value())
+			{
+				// check if source node exist in the graph
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
 			}
+			sourceIndex.push_back(index.value());
+		}
+		for (const auto &target : targets)
+		{
+			auto index = csr.getIndex(target);
+			if (!index.has_value())
+			{
+				// check if target node exist in the graph
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			targetIndex.push_back(index.value());
+		}
+		if (!csr.isWeighted())
+		{
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
+		}
+		const auto &edgeWeight = csr.getEdgeWeight();
+		if (std::any_of(edgeWeight.begin(), edgeWeight.end(), [](double weight)
+						{ return weight < 0; }))
+		{
+			result.errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+			return result;
 		}
 
+		const auto columns = targets.size();
+		result.rowNodes = sources;
+		result.columnNodes = targets;
+		if (sources.empty() || targets.empty())
+		{
+			// empty matrix, no search to do
+			result.success = true;
+			return result;
+		}
+		result.distances.assign(sources.size() * columns, INF_DOUBLE);
+		parallelFor(0, sources.size(), numberOfThreads, 1, [&](std::size_t begin, std::size_t end, unsigned int)
+					{
+						std::vector<double> dist;
+						for (auto row = begin; row < end; ++row)
+						{
+							SHORTESTPATH::csrDijkstra(csr.getOutOffset(), csr.getOutTarget(), csr.getOutWeight(), sourceIndex[row], dist);
+							for (std::size_t column = 0; column < columns; ++column)
+							{
+								result.distances[row * columns + column] = dist[targetIndex[column]];
+							}
+						}
+					});
 		result.success = true;
-		// presense of negative number in the diagonal indicates
-		// that that the graph contains a negative cycle
-		for (const auto &node : nodeSet)
+		return result;
+	}
+
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::manyToMany(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return manyToMany(sources, targets, policy.getNumberOfThreads()); });
+	}
+
+	template <typename T>
+	const KShortestPathsResult Graph<T>::kShortestPaths(const Node<T> &source, const Node<T> &target, std::size_t k, unsigned int numberOfThreads) const
+	{
+		KShortestPathsResult result;
+		result.success = false;
+		result.errorMessage = "";
+		const CSRGraph<T> csr(getEdgeSet());
+		auto sourceIndex = csr.getIndex(&source);
+		if (!sourceIndex.has_value())
+		{
+			// check if source node exist in the graph
+			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+		auto targetIndex = csr.getIndex(&target);
+		if (!targetIndex.has_value())
+		{
+			// check if target node exist in the graph
+			result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+		if (!csr.isWeighted())
 		{
-			auto diag = std::make_pair(node->getUserId(), node->getUserId());
-			if (pairwise_dist[diag] < 0.)
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
+		}
+		const auto &edgeWeight = csr.getEdgeWeight();
+		if (std::any_of(edgeWeight.begin(), edgeWeight.end(), [](double weight)
+						{ return weight < 0; }))
+		{
+			result.errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+			return result;
+		}
+
+		auto paths = SHORTESTPATH::yenKShortestPaths(csr, sourceIndex.value(), targetIndex.value(), k, numberOfThreads);
+		if (paths.empty() && k > 0)
+		{
+			result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+			return result;
+		}
+		const auto &edges = csr.getEdges();
+		for (const auto &path : paths)
+		{
+			std::vector<unsigned long long> edgeIds;
+			edgeIds.reserve(path.edges.size());
+			for (auto edge : path.edges)
 			{
-				result.negativeCycle = true;
-				return result;
+				edgeIds.push_back(edges[edge]->getId());
 			}
+			result.paths.push_back(std::move(edgeIds));
+			result.costs.push_back(path.cost);
 		}
-		result.result = std::move(pairwise_dist);
+		result.success = true;
 		return result;
 	}
 
+	template <typename T>
+	const KShortestPathsResult Graph<T>::kShortestPaths(const Node<T> &source, const Node<T> &target, std::size_t k, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return kShortestPaths(source, target, k, policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	const MstResult Graph<T>::prim() const
 	{
@@ -1445,7 +2171,7 @@ namespace CXXGRAPH
 	}
 
 	template <typename T>
-	const MstResult Graph<T>::boruvka() const
+	const MstResult Graph<T>::boruvka(unsigned int numberOfThreads) const
 	{
 		MstResult result;
 		result.success = false;
@@ -1456,99 +2182,37 @@ namespace CXXGRAPH
 			result.errorMessage = ERR_DIR_GRAPH;
 			return result;
 		}
-		const auto nodeSet = Graph<T>::getNodeSet();
-		const auto n = nodeSet.size();
-
-		// Use std map for storing n subsets.
-		std::unordered_map<unsigned long long, Subset> subsets;
-
-		// Initially there are n different trees.
-		// Finally there will be one tree that will be MST
-		int numTrees = n;
-
-		// check if all edges are weighted and store the weights
-		// in a map whose keys are the edge ids and values are the edge weights
-		const auto edgeSet = Graph<T>::getEdgeSet();
-		std::unordered_map<unsigned long long, double> edgeWeight;
-		for (const auto &edge : edgeSet)
+		const CSRGraph<T> csr(getEdgeSet());
+		const auto &edgeWeighted = csr.getEdgeWeighted();
+		if (!std::all_of(edgeWeighted.begin(), edgeWeighted.end(), [](char weighted)
+						 { return weighted != 0; }))
 		{
-			if (edge->isWeighted().has_value() && edge->isWeighted().value())
-				edgeWeight[edge->getId()] = (dynamic_cast<const Weighted *>(edge))->getWeight();
-			else
-			{
-				// No Weighted Edge
-				result.errorMessage = ERR_NO_WEIGHTED_EDGE;
-				return result;
-			}
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
 		}
 
-		for (const auto &node : nodeSet)
-		{
-			Subset set{node->getId(), 0};
-			subsets[node->getId()] = set;
-		}
+		std::vector<std::size_t> forestEdges;
+		TRAVERSAL::csrParallelBoruvka(csr.getNumberOfNodes(), csr.getEdgeFrom(), csr.getEdgeTo(), csr.getEdgeWeight(), numberOfThreads, forestEdges);
 
 		result.mstCost = 0; // we will store the cost here
-		// exit when only 1 tree i.e. mst
-		while (numTrees > 1)
+		result.mst.reserve(forestEdges.size());
+		for (auto edge : forestEdges)
 		{
-			// Everytime initialize cheapest map
-			// It stores index of the cheapest edge of subset.
-			std::unordered_map<unsigned long long, unsigned long long> cheapest;
-			for (const auto &node : nodeSet)
-				cheapest[node->getId()] = INT_MAX;
-
-			// Traverse through all edges and update
-			// cheapest of every component
-			for (const auto &edge : edgeSet)
-			{
-				auto elem = edge->getNodePair();
-				auto edgeId = edge->getId();
-				// Find sets of two corners of current edge
-				auto set1 = Graph<T>::setFind(&subsets, elem.first->getId());
-				auto set2 = Graph<T>::setFind(&subsets, elem.second->getId());
-
-				// If two corners of current edge belong to
-				// same set, ignore current edge
-				if (set1 == set2)
-					continue;
-
-				// Else check if current edge is closer to previous
-				// cheapest edges of set1 and set2
-				if (cheapest[set1] == INT_MAX ||
-					edgeWeight[cheapest[set1]] > edgeWeight[edgeId])
-					cheapest[set1] = edgeId;
-
-				if (cheapest[set2] == INT_MAX ||
-					edgeWeight[cheapest[set2]] > edgeWeight[edgeId])
-					cheapest[set2] = edgeId;
-			}
-
-			// iterate over all the vertices and add picked
-			// cheapest edges to MST
-			for (const auto &[nodeId, edgeId] : cheapest)
-			{
-				// Check if cheapest for current set exists
-				if (edgeId != INT_MAX)
-				{
-					auto cheapestNode = Graph<T>::getEdge(edgeId).value()->getNodePair();
-					auto set1 = Graph<T>::setFind(&subsets, cheapestNode.first->getId());
-					auto set2 = Graph<T>::setFind(&subsets, cheapestNode.second->getId());
-					if (set1 == set2)
-						continue;
-					result.mstCost += edgeWeight[edgeId];
-					auto newEdgeMST = std::make_pair(cheapestNode.first->getUserId(), cheapestNode.second->getUserId());
-					result.mst.push_back(newEdgeMST);
-					// take union of set1 and set2 and decrease number of trees
-					Graph<T>::setUnion(&subsets, set1, set2);
-					numTrees--;
-				}
-			}
+			result.mstCost += csr.getEdgeWeight()[edge];
+			result.mst.push_back(std::make_pair(csr.getNode(csr.getEdgeFrom()[edge])->getUserId(), csr.getNode(csr.getEdgeTo()[edge])->getUserId()));
 		}
 		result.success = true;
 		return result;
 	}
 
+	template <typename T>
+	const MstResult Graph<T>::boruvka(const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return boruvka(policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	const MstResult Graph<T>::kruskal() const
 	{
@@ -1725,203 +2389,230 @@ namespace CXXGRAPH
 
 		return visited;
 	}
+	template <typename T>
+	const std::vector<Node<T>> Graph<T>::breadth_first_search(const Node<T> &start, const ExecutionPolicy &policy) const
+	{
+		if (policy.isSequential())
+		{
+			return breadth_first_search(start);
+		}
+		return policy.run([&]()
+						  { return concurrency_breadth_first_search(start, policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	const std::vector<Node<T>> Graph<T>::concurrency_breadth_first_search(const Node<T> &start, size_t num_threads) const
 	{
 		std::vector<Node<T>> bfs_result;
+		const CSRGraph<T> csr(getEdgeSet());
 		// check is exist node in the graph
-		auto &nodeSet = Graph<T>::getNodeSet();
-		if (std::find(nodeSet.begin(), nodeSet.end(), &start) == nodeSet.end())
+		auto source = csr.getIndex(&start);
+		if (!source.has_value())
 		{
 			return bfs_result;
 		}
 
-        std::unordered_map<const Node<T> *, int> node_to_index;
-        for (const auto &node : nodeSet)
-        {
-            node_to_index[node] = node_to_index.size();
-        }
-        std::vector<int> visited(nodeSet.size(), 0);
-
-        // parameter limitations
-        if (num_threads <= 0)
-        {
-            std::cout << "Error: number of threads should be greater than 0" << std::endl;
-            num_threads = 2;
-        }
+		// parameter limitations
+		if (num_threads <= 0)
+		{
+			std::cout << "Error: number of threads should be greater than 0" << std::endl;
+			num_threads = 2;
+		}
 
-		const AdjacencyMatrix<T> &adj = Graph<T>::getAdjMatrix();
-		// vector that stores vertices to be visit
-		std::vector<const Node<T> *> level_tracker, next_level_tracker;
-        level_tracker.reserve(static_cast<int>(1.0 *nodeSet.size()));
-        next_level_tracker.reserve(static_cast<int>(1.0 * nodeSet.size()));
+		std::vector<std::size_t> order;
+		TRAVERSAL::csrConcurrentBFS(csr.getOutOffset(), csr.getOutTarget(), source.value(), static_cast<unsigned int>(num_threads), order);
+		bfs_result.reserve(order.size());
+		for (auto index : order)
+		{
+			bfs_result.push_back(*csr.getNode(index));
+		}
+		return bfs_result;
+	}
+	template <typename T>
+	const BFSTreeResult<T> Graph<T>::direction_optimizing_breadth_first_search(const Node<T> &start, unsigned int numberOfThreads) const
+	{
+		BFSTreeResult<T> result;
+		const CSRGraph<T> csr(getEdgeSet());
+		auto source = csr.getIndex(&start);
+		if (!source.has_value())
+		{
+			// check if source node exist in the graph
+			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+		std::vector<std::size_t> depth, parent;
+		TRAVERSAL::csrDirectionOptimizingBFS(csr.getOutOffset(), csr.getOutTarget(), csr.getInOffset(), csr.getInSource(), source.value(), numberOfThreads, depth, parent);
 
-		// mark the starting node as visited
-        visited[node_to_index[&start]] = 1;
-		level_tracker.push_back(&start);
-
-        // a worker is assigned a small part of tasks for each time
-        // assignments of tasks in current level and updates of tasks in next level are inclusive
-        std::mutex tracker_mutex;
-        std::mutex next_tracker_mutex;
-        std::atomic<int> assigned_tasks = 0;
-        int num_tasks = 1;
-        // unit of task assignment, which mean assign block_size tasks to a worker each time
-        int block_size = 1;
-        int level = 1;
-
-        auto extract_tasks = [&level_tracker, &tracker_mutex, &assigned_tasks, &num_tasks, &block_size] () -> std::pair<int,int>
-        {
-            /*
-            std::lock_guard<std::mutex> tracker_guard(tracker_mutex);
-            int task_block_size = std::min(num_tasks - assigned_tasks, block_size);
-            std::pair<int,int> task_block{assigned_tasks, assigned_tasks + task_block_size};
-            assigned_tasks += task_block_size;
-            return task_block;
-            */
-            int start = assigned_tasks.fetch_add(block_size);
-            int end = std::min(num_tasks, start + block_size);
-            return {start, end};
-        };
-
-        auto submit_result = [&next_level_tracker, &next_tracker_mutex] (std::vector<const Node<T> *> &submission) -> void
-        {
-            std::lock_guard<std::mutex> tracker_guard(next_tracker_mutex);
-            next_level_tracker.insert(std::end(next_level_tracker), std::begin(submission), std::end(submission));
-        };
+		// counting sort of the reached nodes by depth
+		std::vector<std::size_t> levelOffset;
+		for (auto d : depth)
+		{
+			if (d != TRAVERSAL::NOT_VISITED)
+			{
+				if (levelOffset.size() < d + 2)
+				{
+					levelOffset.resize(d + 2, 0);
+				}
+				levelOffset[d + 1]++;
+			}
+		}
+		for (std::size_t d = 1; d < levelOffset.size(); ++d)
+		{
+			levelOffset[d] += levelOffset[d - 1];
+		}
+		const auto reached = levelOffset.back();
+		result.nodes.resize(reached);
+		result.depth.resize(reached);
+		result.parent.resize(reached);
+		for (std::size_t v = 0; v < depth.size(); ++v)
+		{
+			if (depth[v] != TRAVERSAL::NOT_VISITED)
+			{
+				auto position = levelOffset[depth[v]]++;
+				result.nodes[position] = csr.getNode(v);
+				result.depth[position] = depth[v];
+				result.parent[position] = parent[v] == TRAVERSAL::NOT_VISITED ? nullptr : csr.getNode(parent[v]);
+			}
+		}
+		result.success = true;
+		return result;
+	}
 
-        // worker thread sleep until it begin to search nodes of next level
-        std::mutex next_level_mutex;
-        std::condition_variable next_level_cond;
-        std::atomic<int> waiting_workers = 0;
+	template <typename T>
+	const BFSTreeResult<T> Graph<T>::direction_optimizing_breadth_first_search(const Node<T> &start, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return direction_optimizing_breadth_first_search(start, policy.getNumberOfThreads()); });
+	}
 
-        auto bfs_worker = [&] () -> void
-        {
-            // algorithm is not done
-            while (!level_tracker.empty())
-            {
-                // search for nodes in a level is not done
-                std::vector<const Node<T> *> local_tracker;
-                while (1)
-                {
-                    auto [start_index, end_index] = extract_tasks();
-                    if (start_index >= end_index)
-                    {
-                        break;
-                    }
-
-                    for (int i = start_index; i < end_index; ++i)
-                    {
-                        if (adj.count(level_tracker[i]))
-                        {
-                            for (const auto &elem : adj.at(level_tracker[i]))
-                            {
-                                int index = node_to_index[elem.first];
-                                if (visited[index] == 0)
-                                {
-                                    visited[index] = 1;
-                                    local_tracker.push_back(elem.first);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                // submit local result to global result
-                if (!local_tracker.empty())
-                {
-                    submit_result(local_tracker);
-                }
-
-                // last worker need to do preparation for the next iteration
-                int cur_level = level;
-                if (num_threads == 1 + waiting_workers.fetch_add(1))
-                {
-                    swap(level_tracker, next_level_tracker);
-                    next_level_tracker.clear();
-
-                    // adjust block_size according to number of nodes in next level
-                    block_size = 4;
-                    if (level_tracker.size() <= num_threads * 4)
-                    {
-                        block_size = std::max(1, static_cast<int>(std::ceil(static_cast<double>(level_tracker.size()) / num_threads)));
-                    }
-                    else if (level_tracker.size() >= num_threads * 64)
-                    {
-                        block_size = 16;
-                    }
-
-                    num_tasks = level_tracker.size();
-                    waiting_workers = 0;
-                    assigned_tasks = 0;
-                    level = level + 1;
-                    next_level_cond.notify_all();
-                }
-                else
-                {
-                    // not to wait if last worker reachs last statement before notify all or even further
-                    std::unique_lock<std::mutex> next_level_lock(next_level_mutex);
-                    next_level_cond.wait(next_level_lock,
-                                        [&level, cur_level] () { return level != cur_level;});
-                }
-            }
-        };
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::multi_source_breadth_first_search(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads) const
+	{
+		DistanceMatrixResult<T> result;
+		const CSRGraph<T> csr(getEdgeSet());
+		std::vector<std::size_t> sourceIndex;
+		for (const auto &source : sources)
+		{
+			auto index = csr.getIndex(source);
+			if (!index.has_value())
+			{
+				// check if source node exist in the graph
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			sourceIndex.push_back(index.value());
+		}
+		// columns of every node, in CSR format
+		const auto n = csr.getNumberOfNodes();
+		std::vector<std::size_t> columnOffset(n + 1, 0), columnList(targets.size());
+		std::vector<std::size_t> targetIndex;
+		for (const auto &target : targets)
+		{
+			auto index = csr.getIndex(target);
+			if (!index.has_value())
+			{
+				// check if target node exist in the graph
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			targetIndex.push_back(index.value());
+			columnOffset[index.value() + 1]++;
+		}
+		for (std::size_t v = 0; v < n; ++v)
+		{
+			columnOffset[v + 1] += columnOffset[v];
+		}
+		auto position = columnOffset;
+		for (std::size_t column = 0; column < targetIndex.size(); ++column)
+		{
+			columnList[position[targetIndex[column]]++] = column;
+		}
 
-        std::vector<std::thread> workers;
-        for (int i = 0; i < num_threads - 1; ++i)
-        {
-            workers.emplace_back(std::thread(bfs_worker));
-        }
-        bfs_worker();
+		const auto columns = targets.size();
+		result.rowNodes = sources;
+		result.columnNodes = targets;
+		result.distances.assign(sources.size() * columns, INF_DOUBLE);
+		TRAVERSAL::csrMultiSourceBFS(csr.getOutOffset(), csr.getOutTarget(), sourceIndex, numberOfThreads, [&](std::size_t row, std::size_t node, std::size_t depth)
+									 {
+										 for (auto i = columnOffset[node]; i < columnOffset[node + 1]; ++i)
+										 {
+											 result.distances[row * columns + columnList[i]] = static_cast<double>(depth);
+										 } });
+		result.success = true;
+		return result;
+	}
 
-        for (auto &worker : workers)
-        {
-            if (worker.joinable())
-            {
-                worker.join();
-            }
-        }
+	template <typename T>
+	const DistanceMatrixResult<T> Graph<T>::multi_source_breadth_first_search(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return multi_source_breadth_first_search(sources, targets, policy.getNumberOfThreads()); });
+	}
 
-        for (const auto &visited_node : nodeSet)
-        {
-            if (visited[node_to_index[visited_node]] != 0)
-            {
-                bfs_result.push_back(*visited_node);
-            }
-        }
+	template <typename T>
+	const ReachabilityResult<T> Graph<T>::multi_source_reachability(const std::vector<const Node<T> *> &sources, unsigned int numberOfThreads) const
+	{
+		ReachabilityResult<T> result;
+		const CSRGraph<T> csr(getEdgeSet());
+		std::vector<std::size_t> sourceIndex;
+		for (const auto &source : sources)
+		{
+			auto index = csr.getIndex(source);
+			if (!index.has_value())
+			{
+				// check if source node exist in the graph
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			sourceIndex.push_back(index.value());
+		}
+		result.sources = sources;
+		result.reachableCount.assign(sources.size(), 0);
+		result.depthSum.assign(sources.size(), 0);
+		TRAVERSAL::csrMultiSourceBFS(csr.getOutOffset(), csr.getOutTarget(), sourceIndex, numberOfThreads, [&result](std::size_t row, std::size_t, std::size_t depth)
+									 {
+										 result.reachableCount[row]++;
+										 result.depthSum[row] += depth; });
+		result.success = true;
+		return result;
+	}
 
-		return bfs_result;
+	template <typename T>
+	const ReachabilityResult<T> Graph<T>::multi_source_reachability(const std::vector<const Node<T> *> &sources, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return multi_source_reachability(sources, policy.getNumberOfThreads()); });
 	}
+
 	template <typename T>
 	const std::vector<Node<T>> Graph<T>::depth_first_search(const Node<T> &start) const
 	{
 		// vector to keep track of visited nodes
 		std::vector<Node<T>> visited;
-		auto nodeSet = Graph<T>::getNodeSet();
+		const CSRGraph<T> csr(getEdgeSet());
 		// check is exist node in the graph
-		if (std::find(nodeSet.begin(), nodeSet.end(), &start) == nodeSet.end())
+		auto source = csr.getIndex(&start);
+		if (!source.has_value())
 		{
 			return visited;
 		}
-		const AdjacencyMatrix<T> adj = Graph<T>::getAdjMatrix();
-		std::function<void(const AdjacencyMatrix<T> &, const Node<T> &, std::vector<Node<T>> &)> explore;
-		explore = [&explore](const AdjacencyMatrix<T> &adj, const Node<T> &node, std::vector<Node<T>> &visited) -> void
-		{
-			visited.push_back(node);
-			if (adj.find(&node) != adj.end())
-			{
-				for (const auto &x : adj.at(&node))
-				{
-					if (std::find(visited.begin(), visited.end(), *(x.first)) == visited.end())
-					{
-						explore(adj, *(x.first), visited);
-					}
-				}
-			}
-		};
-		explore(adj, start, visited);
+		TRAVERSAL::DepthFirstSearch dfs(csr.getOutOffset(), csr.getOutTarget());
+		dfs.run(source.value(), [&visited, &csr](std::size_t node)
+				{ visited.push_back(*csr.getNode(node)); });
+
+		return visited;
+	}
+
+	template <typename T>
+	TRAVERSAL::BreadthFirstRange<T> Graph<T>::breadth_first_range(const Node<T> &start) const
+	{
+		return TRAVERSAL::BreadthFirstRange<T>(std::make_shared<const CSRGraph<T>>(getEdgeSet()), &start);
+	}
 
-		return visited;
+	template <typename T>
+	TRAVERSAL::DepthFirstRange<T> Graph<T>::depth_first_range(const Node<T> &start) const
+	{
+		return TRAVERSAL::DepthFirstRange<T>(std::make_shared<const CSRGraph<T>>(getEdgeSet()), &start);
 	}
 
 	template <typename T>
@@ -1931,87 +2622,23 @@ namespace CXXGRAPH
 		{
 			return false;
 		}
-		enum nodeStates : uint8_t
-		{
-			not_visited,
-			in_stack,
-			visited
-		};
-		auto nodeSet = Graph<T>::getNodeSet();
-		auto adjMatrix = Graph<T>::getAdjMatrix();
-
-		/* State of the node.
-		 *
-		 * It is a vector of "nodeStates" which represents the state node is in.
-		 * It can take only 3 values: "not_visited", "in_stack", and "visited".
-		 *
-		 * Initially, all nodes are in "not_visited" state.
-		 */
-		std::unordered_map<unsigned long long, nodeStates> state;
-		for (const auto &node : nodeSet)
-		{
-			state[node->getId()] = not_visited;
-		}
-		int stateCounter = 0;
-
-		// Start visiting each node.
-		for (const auto &node : nodeSet)
-		{
-			// If a node is not visited, only then check for presence of cycle.
-			// There is no need to check for presence of cycle for a visited
-			// node as it has already been checked for presence of cycle.
-			if (state[node->getId()] == not_visited)
-			{
-				// Check for cycle.
-				std::function<bool(AdjacencyMatrix<T> &, std::unordered_map<unsigned long long, nodeStates> &, const Node<T> *)> isCyclicDFSHelper;
-				isCyclicDFSHelper = [this, &isCyclicDFSHelper](AdjacencyMatrix<T> &adjMatrix, std::unordered_map<unsigned long long, nodeStates> &states, const Node<T> *node)
-				{
-					// Add node "in_stack" state.
-					states[node->getId()] = in_stack;
-
-					// If the node has children, then recursively visit all children of the
-					// node.
-					auto const it = adjMatrix.find(node);
-					if (it != adjMatrix.end())
-					{
-						for (const auto &child : it->second)
-						{
-							// If state of child node is "not_visited", evaluate that child
-							// for presence of cycle.
-							auto state_of_child = states.at((std::get<0>(child))->getId());
-							if (state_of_child == not_visited)
-							{
-								if (isCyclicDFSHelper(adjMatrix, states, std::get<0>(child)))
-								{
-									return true;
-								}
-							}
-							else if (state_of_child == in_stack)
-							{
-								// If child node was "in_stack", then that means that there
-								// is a cycle in the graph. Return true for presence of the
-								// cycle.
-								return true;
-							}
-						}
-					}
-
-					// Current node has been evaluated for the presence of cycle and had no
-					// cycle. Mark current node as "visited".
-					states[node->getId()] = visited;
-					// Return that current node didn't result in any cycles.
-					return false;
-				};
-				if (isCyclicDFSHelper(adjMatrix, state, node))
-				{
-					return true;
-				}
-			}
-		}
-
-		// All nodes have been safely traversed, that means there is no cycle in
-		// the graph. Return false.
-		return false;
+		const CSRGraph<T> csr(getEdgeSet());
+		// a node is in the stack between its pre-order and its post-order visit,
+		// an arc that reaches a node in the stack closes a cycle
+		std::vector<bool> inStack(csr.getNumberOfNodes(), false);
+		bool cyclic = false;
+		TRAVERSAL::DepthFirstSearch dfs(csr.getOutOffset(), csr.getOutTarget());
+		for (std::size_t node = 0; node < csr.getNumberOfNodes() && !cyclic; ++node)
+		{
+			dfs.run(
+				node, [&inStack](std::size_t v)
+				{ inStack[v] = true; },
+				[&inStack](std::size_t v)
+				{ inStack[v] = false; },
+				[&inStack, &cyclic](std::size_t, std::size_t v)
+				{ cyclic = cyclic || inStack[v]; });
+		}
+		return cyclic;
 	}
 
 	template <typename T>
@@ -2167,43 +2794,39 @@ namespace CXXGRAPH
 		}
 		else
 		{
-			auto nodeSet = getNodeSet();
-			auto adjMatrix = getAdjMatrix();
-			// created visited map
-			std::unordered_map<unsigned long, bool> visited;
-			for (const auto &node : nodeSet)
-			{
-				visited[node->getId()] = false;
-			}
-			std::function<void(const Node<T> *)> dfs_helper = [this, &adjMatrix, &visited, &dfs_helper](const Node<T> *source)
-			{
-				// mark the vertex visited
-				visited[source->getId()] = true;
+			return connectedComponents().numberOfComponents <= 1;
+		}
+	}
 
-				// travel the neighbors
-				for (int i = 0; i < adjMatrix[source].size(); i++)
-				{
-					const Node<T> *neighbor = adjMatrix[source].at(i).first;
-					if (visited[neighbor->getId()] == false)
-					{
-						// make recursive call from neighbor
-						dfs_helper(neighbor);
-					}
-				}
-			};
-			// call dfs_helper for the first node
-			dfs_helper(*(nodeSet.begin()));
+	template <typename T>
+	bool Graph<T>::isConnectedGraph(const ExecutionPolicy &policy) const
+	{
+		return isUndirectedGraph() && connectedComponents(policy).numberOfComponents <= 1;
+	}
 
-			// check if all the nodes are visited
-			for (const auto &node : nodeSet)
-			{
-				if (visited[node->getId()] == false)
-				{
-					return false;
-				}
-			}
-			return true;
-		}
+	template <typename T>
+	ComponentLabelResult<T> Graph<T>::connectedComponents(unsigned int numberOfThreads) const
+	{
+		ComponentLabelResult<T> result;
+		const CSRGraph<T> csr(getEdgeSet());
+		result.nodes = csr.getNodes();
+		// the undirected edges are stored in both directions, the others need the incoming arcs
+		const auto &edgeUndirected = csr.getEdgeUndirected();
+		const bool symmetric = std::all_of(edgeUndirected.begin(), edgeUndirected.end(), [](char undirected)
+										   { return undirected != 0; });
+		result.numberOfComponents = TRAVERSAL::csrAfforest(csr.getOutOffset(), csr.getOutTarget(),
+														   symmetric ? nullptr : &csr.getInOffset(),
+														   symmetric ? nullptr : &csr.getInSource(),
+														   numberOfThreads, result.componentId);
+		result.success = true;
+		return result;
+	}
+
+	template <typename T>
+	ComponentLabelResult<T> Graph<T>::connectedComponents(const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return connectedComponents(policy.getNumberOfThreads()); });
 	}
 
 	template <typename T>
@@ -2215,45 +2838,26 @@ namespace CXXGRAPH
 		}
 		else
 		{
-			auto nodeSet = getNodeSet();
-			auto adjMatrix = getAdjMatrix();
-			for (const auto &start_node : nodeSet)
+			const CSRGraph<T> csr(getEdgeSet());
+			const auto n = csr.getNumberOfNodes();
+			if (n == 0)
 			{
-				// created visited map
-				std::unordered_map<unsigned long, bool> visited;
-				for (const auto &node : nodeSet)
-				{
-					visited[node->getId()] = false;
-				}
-				std::function<void(const Node<T> *)> dfs_helper = [this, &adjMatrix, &visited, &dfs_helper](const Node<T> *source)
-				{
-					// mark the vertex visited
-					visited[source->getId()] = true;
-
-					// travel the neighbors
-					for (int i = 0; i < adjMatrix[source].size(); i++)
-					{
-						const Node<T> *neighbor = adjMatrix[source].at(i).first;
-						if (visited[neighbor->getId()] == false)
-						{
-							// make recursive call from neighbor
-							dfs_helper(neighbor);
-						}
-					}
-				};
-				// call dfs_helper for the first node
-				dfs_helper(start_node);
-
-				// check if all the nodes are visited
-				for (const auto &node : nodeSet)
-				{
-					if (visited[node->getId()] == false)
-					{
-						return false;
-					}
-				}
+				return true;
+			}
+			// every node is reached from the first one, and reaches it (search on the transpose)
+			std::size_t reached = 0;
+			TRAVERSAL::DepthFirstSearch forward(csr.getOutOffset(), csr.getOutTarget());
+			forward.run(0, [&reached](std::size_t)
+						{ ++reached; });
+			if (reached != n)
+			{
+				return false;
 			}
-			return true;
+			reached = 0;
+			TRAVERSAL::DepthFirstSearch backward(csr.getInOffset(), csr.getInSource());
+			backward.run(0, [&reached](std::size_t)
+						 { ++reached; });
+			return reached == n;
 		}
 	}
 
@@ -2275,38 +2879,18 @@ namespace CXXGRAPH
         }
         else
         {
-            const auto &adjMatrix = getAdjMatrix();
-            const auto &nodeSet = getNodeSet();
-            std::unordered_map<const Node<T> *, bool> visited;
+            const CSRGraph<T> csr(getEdgeSet());
+            const auto n = csr.getNumberOfNodes();
+            result.nodesInTopoOrder.reserve(n);
 
-            std::function<void(const Node<T> *)> postorder_helper = [&postorder_helper, &adjMatrix, &visited, &result] (const Node<T> *curNode)
+            // reverse post-order of a depth first search
+            TRAVERSAL::DepthFirstSearch dfs(csr.getOutOffset(), csr.getOutTarget());
+            for (std::size_t node = 0; node < n; ++node)
             {
-                visited[curNode] = true;
-
-                if (adjMatrix.find(curNode) != adjMatrix.end())
-                {
-                    for (const auto &edge : adjMatrix.at(curNode))
-                    {
-                        const auto &nextNode = edge.first;
-                        if (false == visited[nextNode])
-                        {
-                            postorder_helper(nextNode);
-                        }
-                    }
-                }
-
-                result.nodesInTopoOrder.push_back(*curNode);
-            };
-
-            int numNodes = adjMatrix.size();
-            result.nodesInTopoOrder.reserve(numNodes);
-
-            for (const auto &node : nodeSet)
-            {
-                if (false == visited[node])
-                {
-                    postorder_helper(node);
-                }
+                dfs.run(
+                    node, [](std::size_t) {},
+                    [&result, &csr](std::size_t v)
+                    { result.nodesInTopoOrder.push_back(*csr.getNode(v)); });
             }
 
             result.success = true;
@@ -2317,6 +2901,12 @@ namespace CXXGRAPH
 
 	template <typename T>
 	TopoSortResult<T> Graph<T>::kahn() const
+	{
+		return kahn(ExecutionPolicy::sequential());
+	}
+
+	template <typename T>
+	TopoSortResult<T> Graph<T>::kahn(const ExecutionPolicy &policy) const
 	{
 		TopoSortResult<T> result;
 
@@ -2327,67 +2917,63 @@ namespace CXXGRAPH
 		}
 		else
 		{
-			const auto adjMatrix = Graph<T>::getAdjMatrix();
-			const auto nodeSet = Graph<T>::getNodeSet();
-			result.nodesInTopoOrder.reserve(adjMatrix.size());
-
-			std::unordered_map<size_t, unsigned int> indegree;
-			for (const auto &node : nodeSet)
-			{
-				indegree[node->getId()] = 0;
-			}
-			for (const auto &list : adjMatrix)
-			{
-				auto children = list.second;
-				for (const auto &child : children)
-				{
-					indegree[std::get<0>(child)->getId()]++;
-				}
-			}
-
-			std::queue<const Node<T>*> topologicalOrder;
-
-			for (const auto &node : nodeSet)
-			{
-				if (!indegree[node->getId()])
-				{
-					topologicalOrder.emplace(node);
-				}
-			}
-
-			size_t visited = 0;
-			while(!topologicalOrder.empty())
-			{
-				const Node<T> *currentNode = topologicalOrder.front();
-				topologicalOrder.pop();
-				result.nodesInTopoOrder.push_back(*currentNode);
-
-				if (adjMatrix.find(currentNode) != adjMatrix.end())
-				{
-					for (const auto &child : adjMatrix.at(currentNode))
-					{
-						if (--indegree[std::get<0>(child)->getId()] == 0)
-						{
-							topologicalOrder.emplace(std::get<0>(child));
-						}
-					}
-				}
-				visited++;
-
-			}
-
-			if (visited != nodeSet.size())
+			const CSRGraph<T> csr(getEdgeSet());
+			std::vector<std::size_t> order;
+			std::vector<std::size_t> level;
+			const bool acyclic = policy.run([&]()
+											{ return TRAVERSAL::csrParallelKahn(csr.getOutOffset(), csr.getOutTarget(), csr.getInOffset(), policy.getNumberOfThreads(), order, level); });
+			if (!acyclic)
 			{
 				result.errorMessage = ERR_CYCLIC_GRAPH;
-				result.nodesInTopoOrder.clear();
 				return result;
 			}
+			result.nodesInTopoOrder.reserve(order.size());
+			for (auto node : order)
+			{
+				result.nodesInTopoOrder.push_back(*csr.getNode(node));
+			}
 
 			result.success = true;
 			return result;
 		}
 	}
 
+	template <typename T>
+	TopoLevelResult<T> Graph<T>::topologicalLevels(unsigned int numberOfThreads) const
+	{
+		TopoLevelResult<T> result;
+		if (!isDirectedGraph())
+		{
+			result.errorMessage = ERR_UNDIR_GRAPH;
+			return result;
+		}
+		const CSRGraph<T> csr(getEdgeSet());
+		std::vector<std::size_t> order;
+		std::vector<std::size_t> level;
+		if (!TRAVERSAL::csrParallelKahn(csr.getOutOffset(), csr.getOutTarget(), csr.getInOffset(), numberOfThreads, order, level))
+		{
+			result.errorMessage = ERR_CYCLIC_GRAPH;
+			return result;
+		}
+		result.nodesInTopoOrder.reserve(order.size());
+		result.level.reserve(order.size());
+		for (auto node : order)
+		{
+			result.nodesInTopoOrder.push_back(csr.getNode(node));
+			result.level.push_back(level[node]);
+		}
+		result.numberOfLevels = order.empty() ? 0 : result.level.back() + 1;
+		result.success = true;
+		return result;
+	}
+
+	template <typename T>
+	TopoLevelResult<T> Graph<T>::topologicalLevels(const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return topologicalLevels(policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
         SCCResult<T> Graph<T>::kosaraju() const
 	{
@@ -2401,83 +2987,32 @@ namespace CXXGRAPH
 		}
 		else
 		{
-			auto nodeSet = getNodeSet();
-			auto adjMatrix = getAdjMatrix();
-			// created visited map
-			std::unordered_map<unsigned long, bool> visited;
-			for (const auto &node : nodeSet)
-			{
-				visited[node->getId()] = false;
-			}
-
-			std::stack<const Node<T> *> st;
-			std::function<void(const Node<T> *)> dfs_helper = [this, &adjMatrix, &visited, &dfs_helper, &st](const Node<T> *source)
-			{
-				// mark the vertex visited
-				visited[source->getId()] = true;
-
-				// travel the neighbors
-				for (int i = 0; i < adjMatrix[source].size(); i++)
-				{
-					const Node<T> *neighbor = adjMatrix[source].at(i).first;
-					if (visited[neighbor->getId()] == false)
-					{
-						// make recursive call from neighbor
-						dfs_helper(neighbor);
-					}
-				}
-
-				st.push(source);
-			};
-
-			for (const auto &node : nodeSet)
-			{
-				if (visited[node->getId()] == false)
-				{
-					dfs_helper(node);
-				}
-			}
+			const CSRGraph<T> csr(getEdgeSet());
+			const auto n = csr.getNumberOfNodes();
 
-			//construct the transpose of the given graph
-			AdjacencyMatrix<T> rev;
-			auto addElementToAdjMatrix = [&rev](const Node<T> *nodeFrom, const Node<T> *nodeTo, const Edge<T> *edge){
-				std::pair<const Node<T> *, const Edge<T> *> elem = {nodeTo, edge};
-				rev[nodeFrom].push_back(std::move(elem));
-			};
-			for (const auto &edgeSetIt : edgeSet)
+			// post-order of a depth first search of the graph
+			std::vector<std::size_t> st;
+			st.reserve(n);
+			TRAVERSAL::DepthFirstSearch dfs(csr.getOutOffset(), csr.getOutTarget());
+			for (std::size_t node = 0; node < n; ++node)
 			{
-				const DirectedEdge<T> *d_edge = dynamic_cast<const DirectedEdge<T> *>(edgeSetIt);
-				//Add the reverse edge to the reverse adjacency matrix
-				addElementToAdjMatrix(&(d_edge->getTo()), &(d_edge->getFrom()), d_edge);
+				dfs.run(
+					node, [](std::size_t) {},
+					[&st](std::size_t v)
+					{ st.push_back(v); });
 			}
 
-			visited.clear();
-
-			std::function<void(const Node<T> *, std::vector<Node<T>> &)> dfs_helper1 = [this, &rev, &visited, &dfs_helper1](const Node<T> *source, std::vector<Node<T>> &comp)
+			// the searches on the transpose of the graph in reverse post-order give the components
+			TRAVERSAL::DepthFirstSearch transposeDfs(csr.getInOffset(), csr.getInSource());
+			while (!st.empty())
 			{
-				// mark the vertex visited
-				visited[source->getId()] = true;
-				//Add the current vertex to the strongly connected component
-				comp.push_back(*source);
-
-				// travel the neighbors
-				for (int i = 0; i < rev[source].size(); i++)
+				auto rem = st.back();
+				st.pop_back();
+				if (!transposeDfs.isVisited(rem))
 				{
-					const Node<T> *neighbor = rev[source].at(i).first;
-					if (visited[neighbor->getId()] == false)
-					{
-						// make recursive call from neighbor
-						dfs_helper1(neighbor, comp);
-					}
-				}
-			};
-
-			while(st.size()!=0){
-				auto rem = st.top();
-				st.pop();
-				if(visited[rem->getId()] == false){
 					std::vector<Node<T>> comp;
-					dfs_helper1(rem, comp);
+					transposeDfs.run(rem, [&comp, &csr](std::size_t v)
+									 { comp.push_back(*csr.getNode(v)); });
 					result.stronglyConnectedComps.push_back(comp);
 				}
 			}
@@ -2487,128 +3022,176 @@ namespace CXXGRAPH
 		}
 	}
 
+	template <typename T>
+	ComponentLabelResult<T> Graph<T>::tarjan() const
+	{
+		ComponentLabelResult<T> result;
+		if (!isDirectedGraph())
+		{
+			result.errorMessage = ERR_UNDIR_GRAPH;
+			return result;
+		}
+		const CSRGraph<T> csr(getEdgeSet());
+		result.nodes = csr.getNodes();
+		result.numberOfComponents = TRAVERSAL::csrTarjanSCC(csr.getOutOffset(), csr.getOutTarget(), result.componentId);
+		result.success = true;
+		return result;
+	}
+
+	template <typename T>
+	ComponentLabelResult<T> Graph<T>::tarjan(const ExecutionPolicy &policy) const
+	{
+		if (policy.isSequential())
+		{
+			return tarjan();
+		}
+		return forward_backward_scc(policy);
+	}
+
+	template <typename T>
+	ComponentLabelResult<T> Graph<T>::forward_backward_scc(unsigned int numberOfThreads) const
+	{
+		ComponentLabelResult<T> result;
+		if (!isDirectedGraph())
+		{
+			result.errorMessage = ERR_UNDIR_GRAPH;
+			return result;
+		}
+		const CSRGraph<T> csr(getEdgeSet());
+		result.nodes = csr.getNodes();
+		result.numberOfComponents = TRAVERSAL::csrForwardBackwardSCC(csr.getOutOffset(), csr.getOutTarget(), csr.getInOffset(), csr.getInSource(), numberOfThreads, result.componentId);
+		result.success = true;
+		return result;
+	}
+
+	template <typename T>
+	ComponentLabelResult<T> Graph<T>::forward_backward_scc(const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return forward_backward_scc(policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	const DialResult Graph<T>::dial(const Node<T> &source, int maxWeight) const
 	{
 		DialResult result;
 		result.success = false;
 
-		auto adj = Graph<T>::getAdjMatrix();
-		auto nodeSet = Graph<T>::getNodeSet();
-
-		if (std::find(nodeSet.begin(), nodeSet.end(), &source) == nodeSet.end())
+		const CSRGraph<T> csr(getEdgeSet());
+		auto sourceIndex = csr.getIndex(&source);
+		if (!sourceIndex.has_value())
 		{
 			// check if source node exist in the graph
 			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
 			return result;
 		}
-		/* With each distance, iterator to that vertex in
-			its bucket is stored so that vertex can be deleted
-			in O(1) at time of updation. So
-			dist[i].first = distance of ith vertex from src vertex
-			dits[i].second = vertex i in bucket number */
-		unsigned int V = nodeSet.size();
-		std::unordered_map<const Node<T> *, std::pair<long, const Node<T> *>> dist;
+		const auto n = csr.getNumberOfNodes();
+		const auto &outOffset = csr.getOutOffset();
+		const auto &outTarget = csr.getOutTarget();
+		const auto &outEdge = csr.getOutEdge();
+		const auto &outWeight = csr.getOutWeight();
+		const auto &edgeWeighted = csr.getEdgeWeighted();
 
-		// Initialize all distances as infinite (INF)
-		for (const auto &node : nodeSet)
+		// the tentative distances are always in a window [d, d + maxWeight], so maxWeight + 1
+		// circular buckets are enough; a heavier edge enlarges the window instead of overflowing it
+		long maxEdgeWeight = std::max(maxWeight, 0);
+		for (std::size_t arc = 0; arc < outWeight.size(); ++arc)
 		{
-			dist[&(*node)].first = std::numeric_limits<long>::max();
+			if (edgeWeighted[outEdge[arc]])
+			{
+				maxEdgeWeight = std::max(maxEdgeWeight, static_cast<long>(outWeight[arc]));
+			}
 		}
+		const auto numberOfBuckets = static_cast<std::size_t>(maxEdgeWeight) + 1;
 
-		// Create buckets B[].
-		// B[i] keep vertex of distance label i
-		std::deque<const Node<T> *> B[maxWeight * V + 1];
-
-		B[0].push_back(&source);
-		dist[&source].first = 0;
+		// every bucket is an intrusive doubly linked list of node indices, so a node
+		// is moved to another bucket in O(1) through its prev/next handles
+		constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+		std::vector<std::size_t> bucketHead(numberOfBuckets, NONE);
+		std::vector<std::size_t> prev(n, NONE), next(n, NONE);
+		// Initialize all distances as infinite (INF)
+		std::vector<long> dist(n, std::numeric_limits<long>::max());
+		std::size_t queued = 0;
 
-		int idx = 0;
-		while (1)
+		auto insert = [&](std::size_t node)
 		{
-			// Go sequentially through buckets till one non-empty
-			// bucket is found
-			while (B[idx].size() == 0 && idx < maxWeight * V)
+			auto &head = bucketHead[static_cast<std::size_t>(dist[node]) % numberOfBuckets];
+			prev[node] = NONE;
+			next[node] = head;
+			if (head != NONE)
 			{
-				idx++;
+				prev[head] = node;
 			}
+			head = node;
+			++queued;
+		};
+		auto erase = [&](std::size_t node)
+		{
+			if (prev[node] != NONE)
+			{
+				next[prev[node]] = next[node];
+			}
+			else
+			{
+				bucketHead[static_cast<std::size_t>(dist[node]) % numberOfBuckets] = next[node];
+			}
+			if (next[node] != NONE)
+			{
+				prev[next[node]] = prev[node];
+			}
+			--queued;
+		};
 
-			// If all buckets are empty, we are done.
-			if (idx == maxWeight * V)
+		dist[sourceIndex.value()] = 0;
+		insert(sourceIndex.value());
+		std::size_t idx = 0;
+		while (queued > 0)
+		{
+			// Go sequentially through buckets till one non-empty
+			// bucket is found
+			while (bucketHead[idx] == NONE)
 			{
-				break;
+				idx = (idx + 1) % numberOfBuckets;
 			}
 
 			// Take top vertex from bucket and pop it
-			auto u = B[idx].front();
-			B[idx].pop_front();
+			auto u = bucketHead[idx];
+			erase(u);
 
 			// Process all adjacents of extracted vertex 'u' and
 			// update their distanced if required.
-			for (const auto &i : adj[u])
+			for (auto arc = outOffset[u]; arc < outOffset[u + 1]; ++arc)
 			{
-				auto v = i.first;
-				int weight = 0;
-				if (i.second->isWeighted().has_value() && i.second->isWeighted().value())
-				{
-					if (i.second->isDirected().has_value() && i.second->isDirected().value())
-					{
-						const DirectedWeightedEdge<T> *dw_edge = dynamic_cast<const DirectedWeightedEdge<T> *>(i.second);
-						weight = dw_edge->getWeight();
-					}
-					else if (i.second->isDirected().has_value() && !i.second->isDirected().value())
-					{
-						const UndirectedWeightedEdge<T> *udw_edge = dynamic_cast<const UndirectedWeightedEdge<T> *>(i.second);
-						weight = udw_edge->getWeight();
-					}
-					else
-					{
-						// ERROR it shouldn't never returned ( does not exist a Node Weighted and not Directed/Undirected)
-						result.errorMessage = ERR_NO_DIR_OR_UNDIR_EDGE;
-						return result;
-					}
-				}
-				else
+				if (!edgeWeighted[outEdge[arc]])
 				{
 					// No Weighted Edge
 					result.errorMessage = ERR_NO_WEIGHTED_EDGE;
 					return result;
 				}
-				auto u_i = std::find_if(dist.begin(), dist.end(), [u](std::pair<const Node<T> *, std::pair<long, const Node<T> *>> const &it)
-										{ return (*u == *(it.first)); });
-
-				auto v_i = std::find_if(dist.begin(), dist.end(), [v](std::pair<const Node<T> *, std::pair<long, const Node<T> *>> const &it)
-										{ return (*v == *(it.first)); });
-				long du = u_i->second.first;
-				long dv = v_i->second.first;
-
+				long weight = static_cast<long>(outWeight[arc]);
+				if (weight < 0)
+				{
+					result.errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+					return result;
+				}
+				auto v = outTarget[arc];
 				// If there is shorted path to v through u.
-				if (dv > du + weight)
+				if (dist[v] > dist[u] + weight)
 				{
-					// If dv is not INF then it must be in B[dv]
-					// bucket, so erase its entry using iterator
-					// in O(1)
-					if (dv != std::numeric_limits<long>::max())
+					// If dv is not INF then it must be in its bucket
+					if (dist[v] != std::numeric_limits<long>::max())
 					{
-						auto findIter = std::find(B[dv].begin(), B[dv].end(), dist[v].second);
-						B[dv].erase(findIter);
+						erase(v);
 					}
-
 					//  updating the distance
-					dist[v].first = du + weight;
-					dv = dist[v].first;
-
-					// pushing vertex v into updated distance's bucket
-					B[dv].push_front(v);
-
-					// storing updated iterator in dist[v].second
-					dist[v].second = *(B[dv].begin());
+					dist[v] = dist[u] + weight;
+					insert(v);
 				}
 			}
 		}
-		for (const auto &dist_i : dist)
+		for (std::size_t i = 0; i < n; ++i)
 		{
-			result.minDistanceMap[dist_i.first->getId()] = dist_i.second.first;
+			result.minDistanceMap[csr.getNode(i)->getId()] = dist[i];
 		}
 		result.success = true;
 
@@ -2688,44 +3271,34 @@ namespace CXXGRAPH
 	}
 
 	template <typename T>
-	const std::vector<Node<T>> Graph<T>::graph_slicing(const Node<T> &start) const
+	const std::vector<Node<T>> Graph<T>::graph_slicing(const Node<T> &start, unsigned int numberOfThreads) const
 	{
 		std::vector<Node<T>> result;
 
-		auto nodeSet = Graph<T>::getNodeSet();
+		const CSRGraph<T> csr(getEdgeSet());
 		// check if start node in the graph
-		if (std::find(nodeSet.begin(), nodeSet.end(), &start) == nodeSet.end())
+		auto index = csr.getIndex(&start);
+		if (!index.has_value())
 		{
 			return result;
 		}
-		std::vector<Node<T>> C = Graph<T>::depth_first_search(start);
-		std::deque<const Node<T> *> C1; // complement of C i.e. nodeSet - C
-		for (auto const &node : nodeSet)
-		{
-			// from the set of all nodes, remove nodes that exist in C
-			if (std::find_if(C.begin(), C.end(), [node](const Node<T> nodeC)
-							 { return (*node == nodeC); }) == C.end())
-				C1.push_back(node);
-		}
-
-		// For all nodes in C', apply DFS
-		//  and get the list of reachable nodes and store in M
-		std::vector<Node<T>> M;
-		for (auto const &node : C1)
-		{
-			std::vector<Node<T>> reachableNodes = Graph<T>::depth_first_search(*node);
-			M.insert(M.end(), reachableNodes.begin(), reachableNodes.end());
-		}
-		// removes nodes from C that are reachable from M.
-		for (const auto &nodeC : C)
+		std::vector<std::size_t> slice;
+		TRAVERSAL::csrGraphSlicing(csr.getOutOffset(), csr.getOutTarget(), index.value(), numberOfThreads, slice);
+		result.reserve(slice.size());
+		for (auto node : slice)
 		{
-			if (std::find_if(M.begin(), M.end(), [nodeC](const Node<T> nodeM)
-							 { return (nodeM == nodeC); }) == M.end())
-				result.push_back(nodeC);
+			result.push_back(*csr.getNode(node));
 		}
 		return result;
 	}
 
+	template <typename T>
+	const std::vector<Node<T>> Graph<T>::graph_slicing(const Node<T> &start, const ExecutionPolicy &policy) const
+	{
+		return policy.run([&]()
+						  { return graph_slicing(start, policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	int Graph<T>::writeToFile(InputOutputFormat format, const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
 	{
@@ -2853,6 +3426,13 @@ namespace CXXGRAPH
 		return partitionMap;
 	}
 
+	template <typename T>
+	PartitionMap<T> Graph<T>::partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions, const ExecutionPolicy &policy, double param1, double param2, double param3) const
+	{
+		return policy.run([&]()
+						  { return partitionGraph(algorithm, numberOfPartitions, param1, param2, param3, policy.getNumberOfThreads()); });
+	}
+
 	template <typename T>
 	std::ostream &operator<<(std::ostream &os, const Graph<T> &graph)
 	{
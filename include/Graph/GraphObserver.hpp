@@ -0,0 +1,64 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_GRAPHOBSERVER_H__
+#define __CXXGRAPH_GRAPHOBSERVER_H__
+
+#pragma once
+
+#include "Edge/Edge.hpp"
+
+namespace CXXGRAPH
+{
+	/// Interface of the structures that are kept up to date with a Graph. An observer attached
+	/// to a Graph is notified after every modification of the Edge Set, so it can repair its
+	/// state instead of recomputing it. The observer must be detached before it is destroyed, unless
+	/// the Graph was destroyed first.
+	template <typename T>
+	class GraphObserver
+	{
+	public:
+		virtual ~GraphObserver() = default;
+		/**
+		 * @brief Called after an edge is added to the Graph
+		 */
+		virtual void onEdgeAdded(const Edge<T> *edge) = 0;
+		/**
+		 * @brief Called after an edge is removed from the Graph
+		 */
+		virtual void onEdgeRemoved(const Edge<T> *edge) = 0;
+		/**
+		 * @brief Called after the weight of an edge of the Graph is changed
+		 *
+		 * @param edge the edge, that already has the new weight
+		 * @param oldWeight the weight before the change
+		 */
+		virtual void onEdgeWeightChanged(const Edge<T> *edge, double oldWeight) = 0;
+		/**
+		 * @brief Called after the whole Edge Set of the Graph is replaced
+		 */
+		virtual void onEdgeSetChanged() = 0;
+		/**
+		 * @brief Called when the Graph is destroyed, the observer is already detached and must not use the Graph anymore
+		 */
+		virtual void onGraphDestroyed() = 0;
+	};
+}
+
+#endif // __CXXGRAPH_GRAPHOBSERVER_H__
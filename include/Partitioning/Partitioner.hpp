@@ -27,6 +27,7 @@
 #include "Edge/Edge.hpp"
 #include "CoordinatedPartitionState.hpp"
 #include "Utility/Runnable.hpp"
+#include "Utility/ThreadPool.hpp"
 #include "PartitionerThread.hpp"
 #include "PartitionAlgorithm.hpp"
 #include "HDRF.hpp"
@@ -152,11 +153,11 @@ namespace CXXGRAPH
             CoordinatedPartitionState<T> state(GLOBALS);
             int processors = GLOBALS.threads;
 
-            std::thread myThreads[processors];
-            std::shared_ptr<Runnable> myRunnable[processors];
-            std::vector<const Edge<T>*> list_vector[processors];
+            std::vector<std::vector<const Edge<T>*>> list_vector(processors);
             int n = dataset->size();
             int subSize = n / processors + 1;
+            // every slice of the dataset is a task of the shared pool
+            TaskGroup group;
             for (int t = 0; t < processors; ++t)
             {
                 int iStart = t * subSize;
@@ -164,26 +165,19 @@ namespace CXXGRAPH
                 if (iEnd >= iStart)
                 {
                     list_vector[t] = std::vector<const Edge<T>*>(std::next(dataset->begin(), iStart), std::next(dataset->begin(), iEnd));
-                    myRunnable[t] = std::make_shared<PartitionerThread<T>>(list_vector[t], &state, algorithm);
-                    myThreads[t] = std::thread(&Runnable::run, myRunnable[t].get());
+                    auto runnable = std::make_shared<PartitionerThread<T>>(list_vector[t], &state, algorithm);
+                    if (processors == 1)
+                    {
+                        runnable->run();
+                    }
+                    else
+                    {
+                        group.run([runnable]()
+                                  { runnable->run(); });
+                    }
                 }
             }
-            for (int t = 0; t < processors; ++t)
-            {
-                if (myThreads[t].joinable()){
-                    myThreads[t].join();
-                }
-                //if(myRunnable[t] != nullptr){
-                //    delete myRunnable[t];
-                //}
-            }
-            /*
-            for (int t = 0; t < processors; ++t){
-                if (runnableList[t] != nullptr){
-                    delete runnableList[t];
-                } 
-            }
-            */
+            group.wait();
             return state;
         }
         template <typename T>
@@ -0,0 +1,494 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_ALT_H__
+#define __CXXGRAPH_SHORTESTPATH_ALT_H__
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <tuple>
+#include <random>
+#include <optional>
+#include <algorithm>
+#include <string>
+#include <chrono>
+#include <functional>
+
+#include "Graph/Graph.hpp"
+#include "Graph/CSRGraph.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ConstString.hpp"
+#include "Utility/Typedef.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/// Class that implement an ALT (A*, Landmarks, Triangle inequality) index over the weighted edges of a Graph.
+		/// The distances from and to a small set of landmarks are precomputed, and the triangle
+		/// inequality on these distances gives a lower bound of the distance to the target that
+		/// is used as heuristic by an A* search.
+		/// The Graph must not be modified after the construction of the index.
+		/// ( This class is not Thread Safe )
+		template <typename T>
+		class ALT
+		{
+		private:
+			using pq_type = std::tuple<double, double, std::size_t>;
+			using min_heap = std::priority_queue<pq_type, std::vector<pq_type>, std::greater<pq_type>>;
+
+			CSRGraph<T> csr;
+			std::size_t numberOfLandmarks = 0;
+			LandmarkSelection selection = LANDMARK_AVOID;
+			std::size_t numberOfActiveLandmarks = 0;
+			bool built = false;
+			std::string errorMessage = "";
+			double preprocessingTime = 0.0;
+
+			std::vector<std::size_t> landmarks = {};
+			// distance from the l-th landmark to v, stored at l * n + v
+			std::vector<double> fromLandmark = {};
+			// distance from v to the l-th landmark, stored at l * n + v
+			std::vector<double> toLandmark = {};
+
+			// query buffers, reset lazily through the touched list
+			mutable std::vector<double> dist = {};
+			mutable std::vector<double> potential = {};
+			mutable std::vector<std::size_t> touched = {};
+			mutable std::vector<std::size_t> active = {};
+			mutable std::size_t lastSettledNodes = 0;
+
+			void addLandmark(std::size_t landmark);
+			std::size_t selectFarthest(const std::vector<double> &coverage) const;
+			std::optional<std::size_t> selectAvoid(std::size_t root) const;
+			double lowerBound(std::size_t v, std::size_t target, const std::vector<std::size_t> &usedLandmarks) const;
+			double search(std::size_t source, std::size_t target) const;
+
+		public:
+			ALT(const Graph<T> &graph, std::size_t numberOfLandmarks = 16, LandmarkSelection selection = LANDMARK_AVOID, std::size_t numberOfActiveLandmarks = 4);
+			~ALT() = default;
+			/**
+			 * @brief Function that select the landmarks and compute their distance arrays
+			 * Note: No Thread Safe
+			 *
+			 * @return 0 if all OK, else return a negative value and the error is reported by getErrorMessage()
+			 */
+			int build();
+			/**
+			 * @brief Function that return the shortest distance between source and target using an A* search
+			 * guided by the landmarks. Only the numberOfActiveLandmarks landmarks that give the best bound
+			 * on the source are used in the search.
+			 * Note: No Thread Safe
+			 *
+			 * @param source source vertex
+			 * @param target target vertex
+			 *
+			 * @return shortest distance if target is reachable from source else ERROR in
+			 * case if target is not reachable from source or there is error in the computation.
+			 */
+			const DijkstraResult query(const Node<T> &source, const Node<T> &target) const;
+
+			bool isBuilt() const;
+			const std::string &getErrorMessage() const;
+			/**
+			 * @brief Return the selected landmarks, in order of selection
+			 */
+			std::vector<const Node<T> *> getLandmarks() const;
+			/**
+			 * @brief Return the size in bytes of the landmark distance arrays
+			 */
+			std::size_t getMemorySize() const;
+			/**
+			 * @brief Return the time spent in the last build() in milliseconds
+			 */
+			double getPreprocessingTime() const;
+			/**
+			 * @brief Return the number of nodes settled by the last query, to compare with the nodes of the graph settled by Dijkstra
+			 */
+			std::size_t getLastQuerySettledNodes() const;
+		};
+
+		template <typename T>
+		ALT<T>::ALT(const Graph<T> &graph, std::size_t numberOfLandmarks, LandmarkSelection selection, std::size_t numberOfActiveLandmarks) : csr(graph.getEdgeSet())
+		{
+			this->numberOfLandmarks = numberOfLandmarks;
+			this->selection = selection;
+			this->numberOfActiveLandmarks = numberOfActiveLandmarks;
+		}
+
+		template <typename T>
+		void ALT<T>::addLandmark(std::size_t landmark)
+		{
+			std::vector<double> distance;
+			csrDijkstra(csr.getOutOffset(), csr.getOutTarget(), csr.getOutWeight(), landmark, distance);
+			fromLandmark.insert(fromLandmark.end(), distance.begin(), distance.end());
+			csrDijkstra(csr.getInOffset(), csr.getInSource(), csr.getInWeight(), landmark, distance);
+			toLandmark.insert(toLandmark.end(), distance.begin(), distance.end());
+			landmarks.push_back(landmark);
+		}
+
+		template <typename T>
+		std::size_t ALT<T>::selectFarthest(const std::vector<double> &coverage) const
+		{
+			// the nodes not connected to any landmark have coverage INF_DOUBLE and are selected first
+			std::size_t farthest = 0;
+			for (std::size_t v = 1; v < coverage.size(); ++v)
+			{
+				if (coverage[v] > coverage[farthest])
+				{
+					farthest = v;
+				}
+			}
+			return farthest;
+		}
+
+		template <typename T>
+		std::optional<std::size_t> ALT<T>::selectAvoid(std::size_t root) const
+		{
+			const auto n = csr.getNumberOfNodes();
+			const auto &outOffset = csr.getOutOffset();
+			std::vector<double> distance;
+			std::vector<std::size_t> order, parentArc;
+			csrDijkstra(outOffset, csr.getOutTarget(), csr.getOutWeight(), root, distance, &order, &parentArc);
+
+			// the weight of a node is the gap between its distance and the bound given by the current landmarks,
+			// the size of a subtree is the sum of the weights, or zero if the subtree already contains a landmark
+			std::vector<double> size(n, 0.0);
+			std::vector<char> hasLandmark(n, 0);
+			std::vector<std::size_t> bestChild(n, NO_PARENT);
+			std::vector<std::size_t> usedLandmarks(landmarks.size());
+			for (std::size_t l = 0; l < landmarks.size(); ++l)
+			{
+				hasLandmark[landmarks[l]] = 1;
+				usedLandmarks[l] = l;
+			}
+			for (const auto &v : order)
+			{
+				auto bound = lowerBound(root, v, usedLandmarks);
+				size[v] = distance[v] - std::min(bound, distance[v]);
+			}
+			for (auto it = order.rbegin(); it != order.rend(); ++it)
+			{
+				auto v = *it;
+				if (hasLandmark[v])
+				{
+					size[v] = 0;
+				}
+				if (parentArc[v] == NO_PARENT)
+				{
+					continue;
+				}
+				auto parent = static_cast<std::size_t>(std::upper_bound(outOffset.begin(), outOffset.end(), parentArc[v]) - outOffset.begin()) - 1;
+				size[parent] += size[v];
+				hasLandmark[parent] = hasLandmark[parent] || hasLandmark[v];
+				if (bestChild[parent] == NO_PARENT || size[v] > size[bestChild[parent]])
+				{
+					bestChild[parent] = v;
+				}
+			}
+			// follow the heaviest subtree down to a leaf
+			auto leaf = root;
+			while (bestChild[leaf] != NO_PARENT && size[bestChild[leaf]] > 0)
+			{
+				leaf = bestChild[leaf];
+			}
+			if (leaf == root || hasLandmark[leaf])
+			{
+				return std::nullopt;
+			}
+			return leaf;
+		}
+
+		template <typename T>
+		int ALT<T>::build()
+		{
+			auto start = std::chrono::steady_clock::now();
+			built = false;
+			errorMessage = "";
+			landmarks.clear();
+			fromLandmark.clear();
+			toLandmark.clear();
+			const auto n = csr.getNumberOfNodes();
+			if (!csr.isWeighted())
+			{
+				errorMessage = ERR_NO_WEIGHTED_EDGE;
+				return -1;
+			}
+			for (const auto &weight : csr.getOutWeight())
+			{
+				if (weight < 0)
+				{
+					errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+					return -1;
+				}
+			}
+
+			const auto k = std::min(numberOfLandmarks, n);
+			if (k > 0)
+			{
+				// minimum distance of every node from and to the landmarks already selected
+				std::vector<double> coverage(n, INF_DOUBLE);
+				std::vector<double> distance;
+				csrDijkstra(csr.getOutOffset(), csr.getOutTarget(), csr.getOutWeight(), 0, distance);
+				for (auto &d : distance)
+				{
+					d = (d == INF_DOUBLE) ? -1.0 : d;
+				}
+				std::mt19937 generator(static_cast<unsigned int>(n));
+				std::uniform_int_distribution<std::size_t> nodeDistribution(0, n - 1);
+				auto landmark = selectFarthest(distance);
+				while (landmarks.size() < k)
+				{
+					addLandmark(landmark);
+					const auto offset = (landmarks.size() - 1) * n;
+					for (std::size_t v = 0; v < n; ++v)
+					{
+						coverage[v] = std::min({coverage[v], fromLandmark[offset + v], toLandmark[offset + v]});
+					}
+					coverage[landmark] = -1.0;
+					if (landmarks.size() == k)
+					{
+						break;
+					}
+					landmark = selectFarthest(coverage);
+					if (selection == LANDMARK_AVOID && coverage[landmark] != INF_DOUBLE)
+					{
+						// the root is random inside the part of the graph already covered by the landmarks
+						auto root = nodeDistribution(generator);
+						auto leaf = selectAvoid(root);
+						if (leaf.has_value())
+						{
+							landmark = leaf.value();
+						}
+					}
+					if (coverage[landmark] < 0)
+					{
+						// every node is already a landmark
+						break;
+					}
+				}
+			}
+
+			dist.assign(n, INF_DOUBLE);
+			potential.assign(n, -1.0);
+			touched.clear();
+			built = true;
+			preprocessingTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			return 0;
+		}
+
+		template <typename T>
+		double ALT<T>::lowerBound(std::size_t v, std::size_t target, const std::vector<std::size_t> &usedLandmarks) const
+		{
+			// usedLandmarks contains positions in the landmarks vector
+			const auto n = csr.getNumberOfNodes();
+			double bound = 0.0;
+			for (const auto &l : usedLandmarks)
+			{
+				const auto offset = l * n;
+				// d(v, L) <= d(v, t) + d(t, L)
+				auto vToL = toLandmark[offset + v];
+				auto tToL = toLandmark[offset + target];
+				if (tToL != INF_DOUBLE)
+				{
+					if (vToL == INF_DOUBLE)
+					{
+						// v would reach the landmark through the target
+						return INF_DOUBLE;
+					}
+					bound = std::max(bound, vToL - tToL);
+				}
+				// d(L, t) <= d(L, v) + d(v, t)
+				auto lToV = fromLandmark[offset + v];
+				auto lToT = fromLandmark[offset + target];
+				if (lToV != INF_DOUBLE)
+				{
+					if (lToT == INF_DOUBLE)
+					{
+						// the landmark would reach the target through v
+						return INF_DOUBLE;
+					}
+					bound = std::max(bound, lToT - lToV);
+				}
+			}
+			return bound;
+		}
+
+		template <typename T>
+		double ALT<T>::search(std::size_t source, std::size_t target) const
+		{
+			for (const auto &node : touched)
+			{
+				dist[node] = INF_DOUBLE;
+				potential[node] = -1.0;
+			}
+			touched.clear();
+			lastSettledNodes = 0;
+
+			// the active landmarks are the ones that give the best bound on the source
+			std::vector<std::pair<double, std::size_t>> bounds;
+			bounds.reserve(landmarks.size());
+			std::vector<std::size_t> single(1);
+			for (std::size_t l = 0; l < landmarks.size(); ++l)
+			{
+				single[0] = l;
+				auto bound = lowerBound(source, target, single);
+				if (bound == INF_DOUBLE)
+				{
+					return INF_DOUBLE;
+				}
+				bounds.push_back(std::make_pair(-bound, l));
+			}
+			auto activeSize = std::min(numberOfActiveLandmarks, bounds.size());
+			std::partial_sort(bounds.begin(), bounds.begin() + activeSize, bounds.end());
+			active.clear();
+			for (std::size_t i = 0; i < activeSize; ++i)
+			{
+				active.push_back(bounds[i].second);
+			}
+
+			const auto &outOffset = csr.getOutOffset();
+			const auto &outTarget = csr.getOutTarget();
+			const auto &outWeight = csr.getOutWeight();
+			auto getPotential = [this, target](std::size_t v)
+			{
+				if (potential[v] < 0)
+				{
+					// every node of the search gets its potential before its distance, so it is touched once here
+					potential[v] = lowerBound(v, target, active);
+					touched.push_back(v);
+				}
+				return potential[v];
+			};
+			min_heap pq;
+			dist[source] = 0;
+			pq.push(std::make_tuple(getPotential(source), 0.0, source));
+			while (!pq.empty())
+			{
+				auto [key, currentDist, node] = pq.top();
+				pq.pop();
+				if (currentDist > dist[node])
+				{
+					continue;
+				}
+				++lastSettledNodes;
+				if (node == target)
+				{
+					return currentDist;
+				}
+				for (auto arc = outOffset[node]; arc < outOffset[node + 1]; ++arc)
+				{
+					auto next = outTarget[arc];
+					auto newDist = currentDist + outWeight[arc];
+					if (newDist < dist[next])
+					{
+						auto bound = getPotential(next);
+						if (bound == INF_DOUBLE)
+						{
+							// the target is not reachable from next
+							continue;
+						}
+						dist[next] = newDist;
+						pq.push(std::make_tuple(newDist + bound, newDist, next));
+					}
+				}
+			}
+			return INF_DOUBLE;
+		}
+
+		template <typename T>
+		const DijkstraResult ALT<T>::query(const Node<T> &source, const Node<T> &target) const
+		{
+			DijkstraResult result;
+			if (!built)
+			{
+				result.errorMessage = ERR_ALT_NOT_BUILT;
+				return result;
+			}
+			auto sourceIndex = csr.getIndex(&source);
+			if (!sourceIndex.has_value())
+			{
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			auto targetIndex = csr.getIndex(&target);
+			if (!targetIndex.has_value())
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			auto distance = search(sourceIndex.value(), targetIndex.value());
+			if (distance == INF_DOUBLE)
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+				return result;
+			}
+			result.success = true;
+			result.result = distance;
+			return result;
+		}
+
+		template <typename T>
+		bool ALT<T>::isBuilt() const
+		{
+			return built;
+		}
+
+		template <typename T>
+		const std::string &ALT<T>::getErrorMessage() const
+		{
+			return errorMessage;
+		}
+
+		template <typename T>
+		std::vector<const Node<T> *> ALT<T>::getLandmarks() const
+		{
+			std::vector<const Node<T> *> result;
+			result.reserve(landmarks.size());
+			for (const auto &landmark : landmarks)
+			{
+				result.push_back(csr.getNode(landmark));
+			}
+			return result;
+		}
+
+		template <typename T>
+		std::size_t ALT<T>::getMemorySize() const
+		{
+			return (fromLandmark.size() + toLandmark.size()) * sizeof(double) + landmarks.size() * sizeof(std::size_t);
+		}
+
+		template <typename T>
+		double ALT<T>::getPreprocessingTime() const
+		{
+			return preprocessingTime;
+		}
+
+		template <typename T>
+		std::size_t ALT<T>::getLastQuerySettledNodes() const
+		{
+			return lastSettledNodes;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_ALT_H__
@@ -0,0 +1,161 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_BLOCKEDFLOYDWARSHALL_H__
+#define __CXXGRAPH_SHORTESTPATH_BLOCKEDFLOYDWARSHALL_H__
+
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		constexpr std::size_t FW_BLOCK_SIZE = 64;
+
+		/**
+		 * @brief Min-plus update of the block (rows, cols) through the intermediate nodes of the block k:
+		 * dist[i][j] = min(dist[i][j], dist[i][k] + dist[k][j]). The innermost loop runs on contiguous
+		 * memory with the AVX or SSE2 min instructions when available, with the same result of the scalar loop.
+		 */
+		inline void floydWarshallBlock(double *dist, std::size_t n, std::size_t rowBegin, std::size_t rowEnd, std::size_t colBegin, std::size_t colEnd, std::size_t kBegin, std::size_t kEnd)
+		{
+			for (auto k = kBegin; k < kEnd; ++k)
+			{
+				const double *rowK = dist + k * n;
+				for (auto i = rowBegin; i < rowEnd; ++i)
+				{
+					double *rowI = dist + i * n;
+					const double distIK = rowI[k];
+					if (distIK == std::numeric_limits<double>::infinity())
+					{
+						// no path i -> k, the row can not improve
+						continue;
+					}
+					auto j = colBegin;
+#if defined(__AVX__)
+					const __m256d distIK4 = _mm256_set1_pd(distIK);
+					for (; j + 4 <= colEnd; j += 4)
+					{
+						__m256d candidate = _mm256_add_pd(distIK4, _mm256_loadu_pd(rowK + j));
+						_mm256_storeu_pd(rowI + j, _mm256_min_pd(candidate, _mm256_loadu_pd(rowI + j)));
+					}
+#elif defined(__SSE2__)
+					const __m128d distIK2 = _mm_set1_pd(distIK);
+					for (; j + 2 <= colEnd; j += 2)
+					{
+						__m128d candidate = _mm_add_pd(distIK2, _mm_loadu_pd(rowK + j));
+						_mm_storeu_pd(rowI + j, _mm_min_pd(candidate, _mm_loadu_pd(rowI + j)));
+					}
+#endif
+					for (; j < colEnd; ++j)
+					{
+						const double candidate = distIK + rowK[j];
+						rowI[j] = candidate < rowI[j] ? candidate : rowI[j];
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief Cache-blocked Floyd-Warshall over a dense row-major n x n matrix.
+		 * For every diagonal block k the algorithm updates first the block (k, k), then the blocks of
+		 * row k and column k, and at last all the remaining blocks; the blocks of the last two phases
+		 * are independent and are distributed between numberOfThreads threads.
+		 * The missing edges must be INF_DOUBLE, the diagonal must be 0 (or the weight of a negative self loop).
+		 *
+		 * @param dist the matrix, updated in place
+		 * @param n the number of nodes
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param blockSize side of the square blocks
+		 */
+		inline void blockedFloydWarshall(std::vector<double> &dist, std::size_t n, unsigned int numberOfThreads = 1, std::size_t blockSize = FW_BLOCK_SIZE)
+		{
+			if (n == 0)
+			{
+				return;
+			}
+			// IEEE infinity keeps the kernel free of the checks for the missing edges
+			const double infinity = std::numeric_limits<double>::infinity();
+			std::replace(dist.begin(), dist.end(), INF_DOUBLE, infinity);
+			blockSize = std::max<std::size_t>(blockSize, 1);
+			const auto blocks = (n + blockSize - 1) / blockSize;
+			auto begin = [blockSize](std::size_t block)
+			{
+				return block * blockSize;
+			};
+			auto end = [blockSize, n](std::size_t block)
+			{
+				return std::min(n, (block + 1) * blockSize);
+			};
+			double *data = dist.data();
+			for (std::size_t k = 0; k < blocks; ++k)
+			{
+				// phase 1: the diagonal block depends only on itself
+				floydWarshallBlock(data, n, begin(k), end(k), begin(k), end(k), begin(k), end(k));
+				// phase 2: the blocks of row k and column k depend on the diagonal block
+				parallelFor(0, 2 * blocks, numberOfThreads, 1, [&](std::size_t first, std::size_t last, unsigned int)
+				{
+					for (auto task = first; task < last; ++task)
+					{
+						auto other = task / 2;
+						if (other == k)
+						{
+							continue;
+						}
+						if (task % 2 == 0)
+						{
+							floydWarshallBlock(data, n, begin(k), end(k), begin(other), end(other), begin(k), end(k));
+						}
+						else
+						{
+							floydWarshallBlock(data, n, begin(other), end(other), begin(k), end(k), begin(k), end(k));
+						}
+					}
+				});
+				// phase 3: every other block depends on its row and column blocks
+				parallelFor(0, blocks * blocks, numberOfThreads, 1, [&](std::size_t first, std::size_t last, unsigned int)
+				{
+					for (auto task = first; task < last; ++task)
+					{
+						auto row = task / blocks;
+						auto col = task % blocks;
+						if (row == k || col == k)
+						{
+							continue;
+						}
+						floydWarshallBlock(data, n, begin(row), end(row), begin(col), end(col), begin(k), end(k));
+					}
+				});
+			}
+			std::replace(dist.begin(), dist.end(), infinity, INF_DOUBLE);
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_BLOCKEDFLOYDWARSHALL_H__
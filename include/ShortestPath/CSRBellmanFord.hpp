@@ -0,0 +1,167 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_CSRBELLMANFORD_H__
+#define __CXXGRAPH_SHORTESTPATH_CSRBELLMANFORD_H__
+
+#pragma once
+
+#include <vector>
+
+#include "Graph/CSRGraph.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/**
+		 * @brief Queue based Bellman-Ford (SPFA) over a CSRGraph. Every round only relaxes the out arcs
+		 * of the nodes improved in the previous round; the rounds whose frontier covers a large part of
+		 * the arcs are relaxed in parallel, with every node pulling from its active in-neighbours.
+		 *
+		 * @param csr the graph
+		 * @param dist starting distances, INF_DOUBLE for the nodes not yet reached; updated in place
+		 * @param frontier nodes whose out arcs are relaxed in the first round (e.g. the source)
+		 * @param numberOfThreads number of threads used by the dense rounds (1 = sequential)
+		 * @param parent if not null, filled with the node that gives the distance of every node (NO_PARENT for the starting nodes and the unreachable ones)
+		 * @param parentEdge if not null, filled with the index in the CSRGraph of the edge that gives the distance of every node
+		 * @return true if a negative cycle is reachable from the starting frontier
+		 */
+		template <typename T>
+		bool csrBellmanFord(const CSRGraph<T> &csr, std::vector<double> &dist, std::vector<std::size_t> frontier, unsigned int numberOfThreads = 1, std::vector<std::size_t> *parent = nullptr, std::vector<std::size_t> *parentEdge = nullptr)
+		{
+			// n denotes the number of vertices in graph
+			const auto n = csr.getNumberOfNodes();
+			const auto &outOffset = csr.getOutOffset();
+			const auto &outTarget = csr.getOutTarget();
+			const auto &outWeight = csr.getOutWeight();
+			const auto &outEdge = csr.getOutEdge();
+			const auto &inOffset = csr.getInOffset();
+			const auto &inSource = csr.getInSource();
+			const auto &inWeight = csr.getInWeight();
+			const auto &inEdge = csr.getInEdge();
+			if (parent)
+			{
+				parent->assign(n, NO_PARENT);
+			}
+			if (parentEdge)
+			{
+				parentEdge->assign(n, NO_PARENT);
+			}
+			auto setParent = [parent, parentEdge](std::size_t node, std::size_t from, std::size_t edge)
+			{
+				if (parent)
+				{
+					(*parent)[node] = from;
+				}
+				if (parentEdge)
+				{
+					(*parentEdge)[node] = edge;
+				}
+			};
+			std::vector<double> previousDist;
+			// next frontier and flags of the nodes in the current and in the next one
+			std::vector<std::size_t> nextFrontier;
+			std::vector<char> inFrontier(n, 0), inNextFrontier(n, 0);
+
+			// after round k every shortest path of at most k edges is final, so a node
+			// improved in round n can only be reached through a negative cycle
+			std::size_t round = 0;
+			while (!frontier.empty() && round < n)
+			{
+				++round;
+				std::size_t frontierArcs = 0;
+				for (const auto &node : frontier)
+				{
+					frontierArcs += outOffset[node + 1] - outOffset[node];
+				}
+				if (numberOfThreads > 1 && frontierArcs * SPFA_DENSE_FRONTIER_DIVISOR > csr.getNumberOfArcs())
+				{
+					// dense round: every node pulls from its active in-neighbours, reading the
+					// distances of the previous round and writing only its own entries
+					for (const auto &node : frontier)
+					{
+						inFrontier[node] = 1;
+					}
+					previousDist = dist;
+					parallelFor(0, n, numberOfThreads, SPFA_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+					{
+						for (auto node = begin; node < end; ++node)
+						{
+							for (auto arc = inOffset[node]; arc < inOffset[node + 1]; ++arc)
+							{
+								auto from = inSource[arc];
+								if (inFrontier[from] && previousDist[from] + inWeight[arc] < dist[node])
+								{
+									dist[node] = previousDist[from] + inWeight[arc];
+									setParent(node, from, inEdge[arc]);
+									inNextFrontier[node] = 1;
+								}
+							}
+						}
+					});
+					for (const auto &node : frontier)
+					{
+						inFrontier[node] = 0;
+					}
+					for (std::size_t node = 0; node < n; ++node)
+					{
+						if (inNextFrontier[node])
+						{
+							nextFrontier.push_back(node);
+						}
+					}
+				}
+				else
+				{
+					// sparse round: relax the out edges of the queued nodes
+					for (const auto &node : frontier)
+					{
+						for (auto arc = outOffset[node]; arc < outOffset[node + 1]; ++arc)
+						{
+							auto next = outTarget[arc];
+							if (dist[node] + outWeight[arc] < dist[next])
+							{
+								dist[next] = dist[node] + outWeight[arc];
+								setParent(next, node, outEdge[arc]);
+								if (!inNextFrontier[next])
+								{
+									inNextFrontier[next] = 1;
+									nextFrontier.push_back(next);
+								}
+							}
+						}
+					}
+				}
+				for (const auto &node : nextFrontier)
+				{
+					inNextFrontier[node] = 0;
+				}
+				frontier.swap(nextFrontier);
+				nextFrontier.clear();
+			}
+			return !frontier.empty();
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_CSRBELLMANFORD_H__
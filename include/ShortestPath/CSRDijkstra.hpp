@@ -0,0 +1,98 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_CSRDIJKSTRA_H__
+#define __CXXGRAPH_SHORTESTPATH_CSRDIJKSTRA_H__
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <functional>
+
+#include "Utility/ConstValue.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		constexpr std::size_t NO_PARENT = std::numeric_limits<std::size_t>::max();
+
+		/**
+		 * @brief Single source Dijkstra over an adjacency in CSR format (one direction of a CSRGraph).
+		 * The arcs of node v are in the range [offset[v], offset[v + 1]), the weights must be non negative.
+		 * The unreachable nodes keep the distance INF_DOUBLE.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param weight weight of every arc
+		 * @param source dense index of the source node
+		 * @param dist output distances, resized to n
+		 * @param order if not null, filled with the nodes in the order they are settled
+		 * @param parentArc if not null, filled with the arc used to reach every node (NO_PARENT for the source and the unreachable nodes)
+		 */
+		inline void csrDijkstra(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, const std::vector<double> &weight, std::size_t source, std::vector<double> &dist, std::vector<std::size_t> *order = nullptr, std::vector<std::size_t> *parentArc = nullptr)
+		{
+			using pq_type = std::pair<double, std::size_t>;
+			const auto n = offset.size() - 1;
+			dist.assign(n, INF_DOUBLE);
+			if (order)
+			{
+				order->clear();
+			}
+			if (parentArc)
+			{
+				parentArc->assign(n, NO_PARENT);
+			}
+			std::priority_queue<pq_type, std::vector<pq_type>, std::greater<pq_type>> pq;
+			dist[source] = 0;
+			pq.push(std::make_pair(0.0, source));
+			while (!pq.empty())
+			{
+				auto [currentDist, node] = pq.top();
+				pq.pop();
+				if (currentDist > dist[node])
+				{
+					continue;
+				}
+				if (order)
+				{
+					order->push_back(node);
+				}
+				for (auto arc = offset[node]; arc < offset[node + 1]; ++arc)
+				{
+					auto newDist = currentDist + weight[arc];
+					auto next = adjacency[arc];
+					if (newDist < dist[next])
+					{
+						dist[next] = newDist;
+						if (parentArc)
+						{
+							(*parentArc)[next] = arc;
+						}
+						pq.push(std::make_pair(newDist, next));
+					}
+				}
+			}
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_CSRDIJKSTRA_H__
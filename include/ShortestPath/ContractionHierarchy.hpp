@@ -0,0 +1,920 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_CONTRACTIONHIERARCHY_H__
+#define __CXXGRAPH_SHORTESTPATH_CONTRACTIONHIERARCHY_H__
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <optional>
+#include <algorithm>
+#include <string>
+#include <chrono>
+#include <fstream>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <tuple>
+
+#include "Graph/Graph.hpp"
+#include "Graph/CSRGraph.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+#include "Utility/ConstString.hpp"
+#include "Utility/Typedef.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/// Class that implement a Contraction Hierarchy over the weighted edges of a Graph.
+		/// The nodes are contracted one by one in the order given by the edge-difference
+		/// heuristic, adding a shortcut every time a shortest path passes through the
+		/// contracted node. The point-to-point queries are then answered by a bidirectional
+		/// Dijkstra that only climbs the hierarchy.
+		/// The Graph must not be modified after the construction of the hierarchy.
+		/// ( This class is not Thread Safe )
+		template <typename T>
+		class ContractionHierarchy
+		{
+		private:
+			struct WorkingArc
+			{
+				std::size_t node;
+				double weight;
+			};
+			using pq_type = std::pair<double, std::size_t>;
+			using min_heap = std::priority_queue<pq_type, std::vector<pq_type>, std::greater<pq_type>>;
+
+			CSRGraph<T> csr;
+			std::size_t witnessSearchLimit = 0;
+			bool built = false;
+			std::string errorMessage = "";
+			double preprocessingTime = 0.0;
+			std::size_t numberOfShortcuts = 0;
+
+			// contraction order of every node
+			std::vector<std::size_t> rank = {};
+			// arcs v->w with rank[w] > rank[v], stored at v
+			std::vector<std::size_t> upOffset = {};
+			std::vector<std::size_t> upTarget = {};
+			std::vector<double> upWeight = {};
+			// arcs u->v with rank[u] > rank[v], stored at v
+			std::vector<std::size_t> downOffset = {};
+			std::vector<std::size_t> downSource = {};
+			std::vector<double> downWeight = {};
+
+			// query buffers, reset lazily through the touched list
+			mutable std::vector<double> forwardDist = {};
+			mutable std::vector<double> backwardDist = {};
+			mutable std::vector<std::size_t> touched = {};
+
+			void contract(std::vector<std::vector<WorkingArc>> &out, std::vector<std::vector<WorkingArc>> &in);
+			void witnessSearch(const std::vector<std::vector<WorkingArc>> &out, const std::vector<char> &contracted, std::size_t source, std::size_t excluded, double maxDistance, std::vector<char> &isTarget, std::size_t targets, std::vector<double> &dist, std::vector<std::size_t> &visited) const;
+			void setUpwardGraph(const std::vector<std::vector<WorkingArc>> &up, const std::vector<std::vector<WorkingArc>> &down);
+			void resetQueryBuffers() const;
+			double upwardSearch(std::size_t source, std::size_t target) const;
+			static void fullUpwardSearch(std::size_t root, const std::vector<std::size_t> &offset, const std::vector<std::size_t> &head, const std::vector<double> &weight,
+										 std::vector<double> &dist, std::vector<std::size_t> &settled);
+
+			static void addOrImprove(std::vector<WorkingArc> &arcs, std::size_t node, double weight);
+			template <typename V>
+			static void writeVector(std::ofstream &ofs, const std::vector<V> &vector);
+			template <typename V>
+			static bool readVector(std::ifstream &ifs, std::vector<V> &vector);
+
+		public:
+			ContractionHierarchy(const Graph<T> &graph, std::size_t witnessSearchLimit = 500);
+			~ContractionHierarchy() = default;
+			/**
+			 * @brief Function that contract all the nodes of the graph and build the upward search graphs
+			 * Note: No Thread Safe
+			 *
+			 * @return 0 if all OK, else return a negative value and the error is reported by getErrorMessage()
+			 */
+			int build();
+			/**
+			 * @brief Function that return the shortest distance between source and target using the hierarchy
+			 * Note: No Thread Safe
+			 *
+			 * @param source source vertex
+			 * @param target target vertex
+			 *
+			 * @return shortest distance if target is reachable from source else ERROR in
+			 * case if target is not reachable from source or there is error in the computation.
+			 */
+			const DijkstraResult query(const Node<T> &source, const Node<T> &target) const;
+			/**
+			 * @brief Function that return the shortest distance between every source and every target.
+			 * An upward search from every target leaves its distance in a bucket of every node it settles,
+			 * then an upward search from every source scans the buckets of the nodes it settles, so the
+			 * cost grows with the number of sources and targets, not with the number of pairs. The
+			 * searches from the sources are distributed between numberOfThreads threads.
+			 *
+			 * @param sources nodes of the rows
+			 * @param targets nodes of the columns
+			 * @param numberOfThreads number of threads (1 = sequential)
+			 * @return the row-major matrix of distances, INF_DOUBLE for the pairs not connected
+			 */
+			const DistanceMatrixResult<T> manyToMany(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads = 1) const;
+			/**
+			 * @brief Function that write the hierarchy in a binary file named OFileName.ch
+			 *
+			 * @param workingDir The path to the directory in which will be placed the output file
+			 * @param OFileName The Output File Name
+			 * @return 0 if all OK, else return a negative value
+			 */
+			int writeToFile(const std::string &workingDir = ".", const std::string &OFileName = "graph") const;
+			/**
+			 * @brief Function that read a hierarchy written by writeToFile. The nodes are matched by user id
+			 * with the nodes of the graph given at the construction.
+			 *
+			 * @param workingDir The path to the directory in which is placed the input file
+			 * @param OFileName The Input File Name
+			 * @return 0 if all OK, else return a negative value
+			 */
+			int readFromFile(const std::string &workingDir = ".", const std::string &OFileName = "graph");
+
+			bool isBuilt() const;
+			const std::string &getErrorMessage() const;
+			/**
+			 * @brief Return the number of shortcuts added during the contraction
+			 */
+			std::size_t getNumberOfShortcuts() const;
+			/**
+			 * @brief Return the time spent in the last build() in milliseconds
+			 */
+			double getPreprocessingTime() const;
+			/**
+			 * @brief Return the position of the node in the contraction order, if the node is in the hierarchy
+			 */
+			std::optional<std::size_t> getRank(const Node<T> &node) const;
+		};
+
+		template <typename T>
+		ContractionHierarchy<T>::ContractionHierarchy(const Graph<T> &graph, std::size_t witnessSearchLimit) : csr(graph.getEdgeSet())
+		{
+			this->witnessSearchLimit = witnessSearchLimit;
+		}
+
+		template <typename T>
+		void ContractionHierarchy<T>::addOrImprove(std::vector<WorkingArc> &arcs, std::size_t node, double weight)
+		{
+			for (auto &arc : arcs)
+			{
+				if (arc.node == node)
+				{
+					arc.weight = std::min(arc.weight, weight);
+					return;
+				}
+			}
+			arcs.push_back({node, weight});
+		}
+
+		template <typename T>
+		int ContractionHierarchy<T>::build()
+		{
+			auto start = std::chrono::steady_clock::now();
+			built = false;
+			errorMessage = "";
+			numberOfShortcuts = 0;
+			const auto n = csr.getNumberOfNodes();
+			if (!csr.isWeighted())
+			{
+				errorMessage = ERR_NO_WEIGHTED_EDGE;
+				return -1;
+			}
+			const auto &outOffset = csr.getOutOffset();
+			const auto &outTarget = csr.getOutTarget();
+			const auto &outWeight = csr.getOutWeight();
+			std::vector<std::vector<WorkingArc>> out(n), in(n);
+			for (std::size_t v = 0; v < n; ++v)
+			{
+				for (auto arc = outOffset[v]; arc < outOffset[v + 1]; ++arc)
+				{
+					if (outWeight[arc] < 0)
+					{
+						errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+						return -1;
+					}
+					auto w = outTarget[arc];
+					// self loops are never part of a shortest path
+					if (w == v)
+					{
+						continue;
+					}
+					addOrImprove(out[v], w, outWeight[arc]);
+					addOrImprove(in[w], v, outWeight[arc]);
+				}
+			}
+			contract(out, in);
+			forwardDist.assign(n, INF_DOUBLE);
+			backwardDist.assign(n, INF_DOUBLE);
+			touched.clear();
+			built = true;
+			preprocessingTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			return 0;
+		}
+
+		template <typename T>
+		void ContractionHierarchy<T>::witnessSearch(const std::vector<std::vector<WorkingArc>> &out, const std::vector<char> &contracted, std::size_t source, std::size_t excluded, double maxDistance, std::vector<char> &isTarget, std::size_t targets, std::vector<double> &dist, std::vector<std::size_t> &visited) const
+		{
+			min_heap pq;
+			dist[source] = 0;
+			visited.push_back(source);
+			pq.push(std::make_pair(0.0, source));
+			std::size_t settled = 0;
+			while (!pq.empty())
+			{
+				auto [currentDist, node] = pq.top();
+				pq.pop();
+				if (currentDist > dist[node])
+				{
+					continue;
+				}
+				if (currentDist > maxDistance || ++settled > witnessSearchLimit)
+				{
+					break;
+				}
+				// stop as soon as the distances of all the targets are final
+				if (isTarget[node])
+				{
+					isTarget[node] = 0;
+					if (--targets == 0)
+					{
+						break;
+					}
+				}
+				for (const auto &arc : out[node])
+				{
+					if (arc.node == excluded || contracted[arc.node])
+					{
+						continue;
+					}
+					auto newDist = currentDist + arc.weight;
+					if (newDist < dist[arc.node])
+					{
+						if (dist[arc.node] == INF_DOUBLE)
+						{
+							visited.push_back(arc.node);
+						}
+						dist[arc.node] = newDist;
+						pq.push(std::make_pair(newDist, arc.node));
+					}
+				}
+			}
+		}
+
+		template <typename T>
+		void ContractionHierarchy<T>::contract(std::vector<std::vector<WorkingArc>> &out, std::vector<std::vector<WorkingArc>> &in)
+		{
+			const auto n = out.size();
+			std::vector<char> contracted(n, 0);
+			std::vector<int> contractedNeighbours(n, 0);
+			std::vector<int> priority(n, 0);
+			std::vector<std::vector<WorkingArc>> up(n), down(n);
+			std::vector<double> witnessDist(n, INF_DOUBLE);
+			std::vector<char> isTarget(n, 0);
+			std::vector<std::size_t> visited;
+			rank.assign(n, 0);
+
+			// Simulate (or perform) the contraction of v, returns the number of shortcuts needed
+			auto processNode = [&](std::size_t v, bool apply) -> int
+			{
+				int shortcuts = 0;
+				for (const auto &inArc : in[v])
+				{
+					auto u = inArc.node;
+					double maxDistance = 0;
+					std::size_t targets = 0;
+					for (const auto &outArc : out[v])
+					{
+						maxDistance = std::max(maxDistance, inArc.weight + outArc.weight);
+						if (outArc.node != u)
+						{
+							isTarget[outArc.node] = 1;
+							targets++;
+						}
+					}
+					if (targets == 0)
+					{
+						continue;
+					}
+					witnessSearch(out, contracted, u, v, maxDistance, isTarget, targets, witnessDist, visited);
+					for (const auto &outArc : out[v])
+					{
+						auto w = outArc.node;
+						if (w == u)
+						{
+							continue;
+						}
+						auto viaDistance = inArc.weight + outArc.weight;
+						if (witnessDist[w] > viaDistance)
+						{
+							shortcuts++;
+							if (apply)
+							{
+								addOrImprove(out[u], w, viaDistance);
+								addOrImprove(in[w], u, viaDistance);
+							}
+						}
+					}
+					for (const auto &node : visited)
+					{
+						witnessDist[node] = INF_DOUBLE;
+					}
+					for (const auto &outArc : out[v])
+					{
+						isTarget[outArc.node] = 0;
+					}
+					visited.clear();
+				}
+				return shortcuts;
+			};
+			// edge difference plus the number of contracted neighbours, that spread the contraction uniformly
+			auto computePriority = [&](std::size_t v) -> int
+			{
+				return 2 * (processNode(v, false) - static_cast<int>(in[v].size() + out[v].size())) + contractedNeighbours[v];
+			};
+
+			std::priority_queue<std::pair<int, std::size_t>, std::vector<std::pair<int, std::size_t>>, std::greater<std::pair<int, std::size_t>>> order;
+			for (std::size_t v = 0; v < n; ++v)
+			{
+				priority[v] = computePriority(v);
+				order.push(std::make_pair(priority[v], v));
+			}
+
+			std::size_t currentRank = 0;
+			while (!order.empty())
+			{
+				auto [nodePriority, v] = order.top();
+				order.pop();
+				if (contracted[v] || nodePriority != priority[v])
+				{
+					// stale entry
+					continue;
+				}
+				// lazy update: the priority could be changed since the last evaluation
+				priority[v] = computePriority(v);
+				if (!order.empty() && priority[v] > order.top().first)
+				{
+					order.push(std::make_pair(priority[v], v));
+					continue;
+				}
+
+				numberOfShortcuts += processNode(v, true);
+				rank[v] = currentRank++;
+				contracted[v] = 1;
+				up[v] = out[v];
+				down[v] = in[v];
+
+				// remove v from the remaining graph and update the neighbours
+				std::vector<std::size_t> neighbours;
+				for (const auto &arc : out[v])
+				{
+					auto &arcs = in[arc.node];
+					arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [v](const WorkingArc &a)
+											  { return a.node == v; }),
+							   arcs.end());
+					neighbours.push_back(arc.node);
+				}
+				for (const auto &arc : in[v])
+				{
+					auto &arcs = out[arc.node];
+					arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [v](const WorkingArc &a)
+											  { return a.node == v; }),
+							   arcs.end());
+					neighbours.push_back(arc.node);
+				}
+				out[v].clear();
+				in[v].clear();
+				for (const auto &neighbour : neighbours)
+				{
+					contractedNeighbours[neighbour]++;
+				}
+				for (const auto &neighbour : neighbours)
+				{
+					auto newPriority = computePriority(neighbour);
+					if (newPriority != priority[neighbour])
+					{
+						priority[neighbour] = newPriority;
+						order.push(std::make_pair(newPriority, neighbour));
+					}
+				}
+			}
+			setUpwardGraph(up, down);
+		}
+
+		template <typename T>
+		void ContractionHierarchy<T>::setUpwardGraph(const std::vector<std::vector<WorkingArc>> &up, const std::vector<std::vector<WorkingArc>> &down)
+		{
+			const auto n = up.size();
+			upOffset.assign(n + 1, 0);
+			downOffset.assign(n + 1, 0);
+			upTarget.clear();
+			upWeight.clear();
+			downSource.clear();
+			downWeight.clear();
+			for (std::size_t v = 0; v < n; ++v)
+			{
+				for (const auto &arc : up[v])
+				{
+					upTarget.push_back(arc.node);
+					upWeight.push_back(arc.weight);
+				}
+				upOffset[v + 1] = upTarget.size();
+				for (const auto &arc : down[v])
+				{
+					downSource.push_back(arc.node);
+					downWeight.push_back(arc.weight);
+				}
+				downOffset[v + 1] = downSource.size();
+			}
+		}
+
+		template <typename T>
+		void ContractionHierarchy<T>::resetQueryBuffers() const
+		{
+			for (const auto &node : touched)
+			{
+				forwardDist[node] = INF_DOUBLE;
+				backwardDist[node] = INF_DOUBLE;
+			}
+			touched.clear();
+		}
+
+		template <typename T>
+		double ContractionHierarchy<T>::upwardSearch(std::size_t source, std::size_t target) const
+		{
+			min_heap forward, backward;
+			forwardDist[source] = 0;
+			backwardDist[target] = 0;
+			touched.push_back(source);
+			touched.push_back(target);
+			forward.push(std::make_pair(0.0, source));
+			backward.push(std::make_pair(0.0, target));
+			double best = INF_DOUBLE;
+
+			auto step = [this, &best](min_heap &pq, std::vector<double> &dist, const std::vector<double> &otherDist,
+									  const std::vector<std::size_t> &offset, const std::vector<std::size_t> &head, const std::vector<double> &weight)
+			{
+				auto [currentDist, node] = pq.top();
+				pq.pop();
+				if (currentDist > dist[node])
+				{
+					return;
+				}
+				if (otherDist[node] != INF_DOUBLE)
+				{
+					best = std::min(best, currentDist + otherDist[node]);
+				}
+				for (auto arc = offset[node]; arc < offset[node + 1]; ++arc)
+				{
+					auto next = head[arc];
+					auto newDist = currentDist + weight[arc];
+					if (newDist < dist[next])
+					{
+						if (forwardDist[next] == INF_DOUBLE && backwardDist[next] == INF_DOUBLE)
+						{
+							touched.push_back(next);
+						}
+						dist[next] = newDist;
+						pq.push(std::make_pair(newDist, next));
+					}
+				}
+			};
+
+			while (!forward.empty() || !backward.empty())
+			{
+				// a direction is done when its minimum key cannot improve the best distance
+				if (!forward.empty() && forward.top().first >= best)
+				{
+					forward = min_heap();
+				}
+				if (!backward.empty() && backward.top().first >= best)
+				{
+					backward = min_heap();
+				}
+				if (forward.empty() && backward.empty())
+				{
+					break;
+				}
+				if (backward.empty() || (!forward.empty() && forward.top().first <= backward.top().first))
+				{
+					step(forward, forwardDist, backwardDist, upOffset, upTarget, upWeight);
+				}
+				else
+				{
+					step(backward, backwardDist, forwardDist, downOffset, downSource, downWeight);
+				}
+			}
+			resetQueryBuffers();
+			return best;
+		}
+
+		template <typename T>
+		const DijkstraResult ContractionHierarchy<T>::query(const Node<T> &source, const Node<T> &target) const
+		{
+			DijkstraResult result;
+			if (!built)
+			{
+				result.errorMessage = ERR_CH_NOT_BUILT;
+				return result;
+			}
+			auto sourceIndex = csr.getIndex(&source);
+			if (!sourceIndex.has_value())
+			{
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			auto targetIndex = csr.getIndex(&target);
+			if (!targetIndex.has_value())
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			auto distance = upwardSearch(sourceIndex.value(), targetIndex.value());
+			if (distance == INF_DOUBLE)
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+				return result;
+			}
+			result.success = true;
+			result.result = distance;
+			return result;
+		}
+
+		template <typename T>
+		void ContractionHierarchy<T>::fullUpwardSearch(std::size_t root, const std::vector<std::size_t> &offset, const std::vector<std::size_t> &head, const std::vector<double> &weight,
+														std::vector<double> &dist, std::vector<std::size_t> &settled)
+		{
+			// dist must be INF_DOUBLE everywhere, the caller resets the settled nodes
+			min_heap pq;
+			dist[root] = 0;
+			pq.push(std::make_pair(0.0, root));
+			while (!pq.empty())
+			{
+				auto [currentDist, node] = pq.top();
+				pq.pop();
+				if (currentDist > dist[node])
+				{
+					continue;
+				}
+				settled.push_back(node);
+				for (auto arc = offset[node]; arc < offset[node + 1]; ++arc)
+				{
+					auto next = head[arc];
+					if (currentDist + weight[arc] < dist[next])
+					{
+						dist[next] = currentDist + weight[arc];
+						pq.push(std::make_pair(dist[next], next));
+					}
+				}
+			}
+		}
+
+		template <typename T>
+		const DistanceMatrixResult<T> ContractionHierarchy<T>::manyToMany(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads) const
+		{
+			DistanceMatrixResult<T> result;
+			if (!built)
+			{
+				result.errorMessage = ERR_CH_NOT_BUILT;
+				return result;
+			}
+			std::vector<std::size_t> sourceIndex, targetIndex;
+			for (const auto &source : sources)
+			{
+				auto index = csr.getIndex(source);
+				if (!index.has_value())
+				{
+					result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+					return result;
+				}
+				sourceIndex.push_back(index.value());
+			}
+			for (const auto &target : targets)
+			{
+				auto index = csr.getIndex(target);
+				if (!index.has_value())
+				{
+					result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+					return result;
+				}
+				targetIndex.push_back(index.value());
+			}
+			const auto n = csr.getNumberOfNodes();
+			const auto columns = targets.size();
+			result.rowNodes = sources;
+			result.columnNodes = targets;
+			if (sources.empty() || targets.empty())
+			{
+				// empty matrix, no search to do
+				result.success = true;
+				return result;
+			}
+
+			// backward upward search from every target, the entries are grouped by node in buckets
+			std::vector<std::tuple<std::size_t, std::size_t, double>> entries;
+			std::vector<double> dist(n, INF_DOUBLE);
+			std::vector<std::size_t> settled;
+			for (std::size_t column = 0; column < columns; ++column)
+			{
+				fullUpwardSearch(targetIndex[column], downOffset, downSource, downWeight, dist, settled);
+				for (auto node : settled)
+				{
+					entries.emplace_back(node, column, dist[node]);
+					dist[node] = INF_DOUBLE;
+				}
+				settled.clear();
+			}
+			std::vector<std::size_t> bucketOffset(n + 1, 0);
+			for (const auto &entry : entries)
+			{
+				++bucketOffset[std::get<0>(entry) + 1];
+			}
+			for (std::size_t v = 0; v < n; ++v)
+			{
+				bucketOffset[v + 1] += bucketOffset[v];
+			}
+			std::vector<std::size_t> bucketColumn(entries.size());
+			std::vector<double> bucketDist(entries.size());
+			{
+				auto position = bucketOffset;
+				for (const auto &[node, column, d] : entries)
+				{
+					bucketColumn[position[node]] = column;
+					bucketDist[position[node]] = d;
+					++position[node];
+				}
+			}
+			std::vector<std::tuple<std::size_t, std::size_t, double>>().swap(entries);
+
+			// forward upward search from every source, that scans the buckets of the settled nodes
+			result.distances.assign(sources.size() * columns, INF_DOUBLE);
+			std::vector<std::vector<double>> threadDist(std::max(numberOfThreads, 1u));
+			parallelFor(0, sources.size(), numberOfThreads, 1, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+						{
+							auto &forwardDist = threadDist[threadId];
+							forwardDist.resize(n, INF_DOUBLE);
+							std::vector<std::size_t> forwardSettled;
+							for (auto row = begin; row < end; ++row)
+							{
+								auto *rowDistances = &result.distances[row * columns];
+								fullUpwardSearch(sourceIndex[row], upOffset, upTarget, upWeight, forwardDist, forwardSettled);
+								for (auto node : forwardSettled)
+								{
+									for (auto entry = bucketOffset[node]; entry < bucketOffset[node + 1]; ++entry)
+									{
+										rowDistances[bucketColumn[entry]] = std::min(rowDistances[bucketColumn[entry]], forwardDist[node] + bucketDist[entry]);
+									}
+									forwardDist[node] = INF_DOUBLE;
+								}
+								forwardSettled.clear();
+							}
+						});
+			result.success = true;
+			return result;
+		}
+
+		template <typename T>
+		template <typename V>
+		void ContractionHierarchy<T>::writeVector(std::ofstream &ofs, const std::vector<V> &vector)
+		{
+			uint64_t size = vector.size();
+			ofs.write(reinterpret_cast<const char *>(&size), sizeof(size));
+			ofs.write(reinterpret_cast<const char *>(vector.data()), size * sizeof(V));
+		}
+
+		template <typename T>
+		template <typename V>
+		bool ContractionHierarchy<T>::readVector(std::ifstream &ifs, std::vector<V> &vector)
+		{
+			uint64_t size = 0;
+			if (!ifs.read(reinterpret_cast<char *>(&size), sizeof(size)))
+			{
+				return false;
+			}
+			// refuse sizes that the rest of the file cannot hold before allocating
+			auto position = ifs.tellg();
+			ifs.seekg(0, std::ios::end);
+			auto end = ifs.tellg();
+			ifs.seekg(position);
+			if (!ifs || position < 0 || end < position || size > static_cast<uint64_t>(end - position) / sizeof(V))
+			{
+				return false;
+			}
+			vector.resize(size);
+			return static_cast<bool>(ifs.read(reinterpret_cast<char *>(vector.data()), size * sizeof(V)));
+		}
+
+		template <typename T>
+		int ContractionHierarchy<T>::writeToFile(const std::string &workingDir, const std::string &OFileName) const
+		{
+			if (!built)
+			{
+				return -1;
+			}
+			std::ofstream ofs(workingDir + "/" + OFileName + ".ch", std::ios::binary);
+			if (!ofs.is_open())
+			{
+				// ERROR File Not Open
+				return -1;
+			}
+			ofs.write(CH_FILE_MAGIC, sizeof(CH_FILE_MAGIC));
+			uint64_t n = csr.getNumberOfNodes();
+			uint64_t shortcuts = numberOfShortcuts;
+			ofs.write(reinterpret_cast<const char *>(&n), sizeof(n));
+			ofs.write(reinterpret_cast<const char *>(&shortcuts), sizeof(shortcuts));
+			for (const auto &node : csr.getNodes())
+			{
+				uint64_t length = node->getUserId().size();
+				ofs.write(reinterpret_cast<const char *>(&length), sizeof(length));
+				ofs.write(node->getUserId().data(), length);
+			}
+			std::vector<uint64_t> buffer(rank.begin(), rank.end());
+			writeVector(ofs, buffer);
+			buffer.assign(upOffset.begin(), upOffset.end());
+			writeVector(ofs, buffer);
+			buffer.assign(upTarget.begin(), upTarget.end());
+			writeVector(ofs, buffer);
+			writeVector(ofs, upWeight);
+			buffer.assign(downOffset.begin(), downOffset.end());
+			writeVector(ofs, buffer);
+			buffer.assign(downSource.begin(), downSource.end());
+			writeVector(ofs, buffer);
+			writeVector(ofs, downWeight);
+			return ofs.good() ? 0 : -1;
+		}
+
+		template <typename T>
+		int ContractionHierarchy<T>::readFromFile(const std::string &workingDir, const std::string &OFileName)
+		{
+			std::ifstream ifs(workingDir + "/" + OFileName + ".ch", std::ios::binary);
+			if (!ifs.is_open())
+			{
+				// ERROR File Not Open
+				return -1;
+			}
+			char magic[sizeof(CH_FILE_MAGIC)];
+			if (!ifs.read(magic, sizeof(magic)) || std::string(magic, sizeof(magic)) != std::string(CH_FILE_MAGIC, sizeof(CH_FILE_MAGIC)))
+			{
+				return -1;
+			}
+			uint64_t n = 0, shortcuts = 0;
+			ifs.read(reinterpret_cast<char *>(&n), sizeof(n));
+			ifs.read(reinterpret_cast<char *>(&shortcuts), sizeof(shortcuts));
+			if (!ifs || n != csr.getNumberOfNodes())
+			{
+				return -1;
+			}
+			// match the nodes of the file with the nodes of the graph by user id
+			std::unordered_map<std::string, std::size_t> userIdToIndex;
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				userIdToIndex[csr.getNode(i)->getUserId()] = i;
+			}
+			std::vector<std::size_t> permutation(n);
+			std::vector<bool> matched(n, false);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				std::vector<char> userId;
+				if (!readVector(ifs, userId))
+				{
+					return -1;
+				}
+				auto it = userIdToIndex.find(std::string(userId.begin(), userId.end()));
+				if (it == userIdToIndex.end() || matched[it->second])
+				{
+					// unknown or duplicated user id
+					return -1;
+				}
+				matched[it->second] = true;
+				permutation[i] = it->second;
+			}
+			std::vector<uint64_t> fileRank, fileUpOffset, fileUpTarget, fileDownOffset, fileDownSource;
+			std::vector<double> fileUpWeight, fileDownWeight;
+			if (!readVector(ifs, fileRank) || !readVector(ifs, fileUpOffset) || !readVector(ifs, fileUpTarget) || !readVector(ifs, fileUpWeight) ||
+				!readVector(ifs, fileDownOffset) || !readVector(ifs, fileDownSource) || !readVector(ifs, fileDownWeight))
+			{
+				return -1;
+			}
+			if (fileRank.size() != n || fileUpOffset.size() != n + 1 || fileDownOffset.size() != n + 1 ||
+				fileUpWeight.size() != fileUpTarget.size() || fileDownWeight.size() != fileDownSource.size())
+			{
+				return -1;
+			}
+			// offsets must be monotone and cover exactly the arc arrays, every arc endpoint must be a node
+			auto validOffsets = [](const std::vector<uint64_t> &offset, std::size_t arcs)
+			{
+				if (offset.front() != 0 || offset.back() != arcs)
+				{
+					return false;
+				}
+				for (std::size_t i = 0; i + 1 < offset.size(); ++i)
+				{
+					if (offset[i] > offset[i + 1])
+					{
+						return false;
+					}
+				}
+				return true;
+			};
+			auto validEndpoints = [n](const std::vector<uint64_t> &endpoint)
+			{
+				for (auto node : endpoint)
+				{
+					if (node >= n)
+					{
+						return false;
+					}
+				}
+				return true;
+			};
+			if (!validOffsets(fileUpOffset, fileUpTarget.size()) || !validOffsets(fileDownOffset, fileDownSource.size()) ||
+				!validEndpoints(fileUpTarget) || !validEndpoints(fileDownSource))
+			{
+				return -1;
+			}
+
+			std::vector<std::vector<WorkingArc>> up(n), down(n);
+			rank.assign(n, 0);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				auto v = permutation[i];
+				rank[v] = fileRank[i];
+				for (auto arc = fileUpOffset[i]; arc < fileUpOffset[i + 1]; ++arc)
+				{
+					up[v].push_back({permutation[fileUpTarget[arc]], fileUpWeight[arc]});
+				}
+				for (auto arc = fileDownOffset[i]; arc < fileDownOffset[i + 1]; ++arc)
+				{
+					down[v].push_back({permutation[fileDownSource[arc]], fileDownWeight[arc]});
+				}
+			}
+			setUpwardGraph(up, down);
+			numberOfShortcuts = shortcuts;
+			forwardDist.assign(n, INF_DOUBLE);
+			backwardDist.assign(n, INF_DOUBLE);
+			touched.clear();
+			errorMessage = "";
+			built = true;
+			return 0;
+		}
+
+		template <typename T>
+		bool ContractionHierarchy<T>::isBuilt() const
+		{
+			return built;
+		}
+
+		template <typename T>
+		const std::string &ContractionHierarchy<T>::getErrorMessage() const
+		{
+			return errorMessage;
+		}
+
+		template <typename T>
+		std::size_t ContractionHierarchy<T>::getNumberOfShortcuts() const
+		{
+			return numberOfShortcuts;
+		}
+
+		template <typename T>
+		double ContractionHierarchy<T>::getPreprocessingTime() const
+		{
+			return preprocessingTime;
+		}
+
+		template <typename T>
+		std::optional<std::size_t> ContractionHierarchy<T>::getRank(const Node<T> &node) const
+		{
+			auto index = csr.getIndex(&node);
+			if (!built || !index.has_value())
+			{
+				return std::nullopt;
+			}
+			return rank[index.value()];
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_CONTRACTIONHIERARCHY_H__
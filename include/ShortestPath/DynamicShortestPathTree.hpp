@@ -0,0 +1,522 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_DYNAMICSHORTESTPATHTREE_H__
+#define __CXXGRAPH_SHORTESTPATH_DYNAMICSHORTESTPATHTREE_H__
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+
+#include "Graph/Graph.hpp"
+#include "Graph/GraphObserver.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ConstString.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/// Class that maintain the shortest path tree of a source node while the Graph changes.
+		/// The tree is attached to the Graph as an observer: after an edge insertion or a weight
+		/// decrease the new distances are propagated only from the head of the edge, after an edge
+		/// deletion or a weight increase only the subtree below the edge is invalidated and repaired
+		/// from its boundary. Every edge of the Graph must be weighted and non negative, else the tree
+		/// is not valid until the wrong edges are removed or fixed.
+		/// The Graph should outlive the tree: if it is destroyed first the tree keeps its last distances.
+		/// ( This class is not Thread Safe )
+		template <typename T>
+		class DynamicShortestPathTree : public GraphObserver<T>
+		{
+		private:
+			struct Arc
+			{
+				std::size_t node;
+				const Edge<T> *edge;
+			};
+			using pq_type = std::pair<double, std::size_t>;
+			using min_heap = std::priority_queue<pq_type, std::vector<pq_type>, std::greater<pq_type>>;
+
+			// null after the Graph is destroyed
+			Graph<T> *graph = nullptr;
+			const Node<T> *source = nullptr;
+			std::size_t unweightedEdges = 0;
+			std::size_t negativeEdges = 0;
+
+			std::vector<const Node<T> *> nodes = {};
+			std::unordered_map<const Node<T> *, std::size_t> nodeIndex = {};
+			std::vector<std::vector<Arc>> outArcs = {};
+			std::vector<std::vector<Arc>> inArcs = {};
+			std::vector<double> dist = {};
+			std::vector<std::size_t> parent = {};
+			std::vector<const Edge<T> *> parentEdge = {};
+			std::vector<char> inAffected = {};
+
+			unsigned long long numberOfUpdates = 0;
+			unsigned long long totalRepairedNodes = 0;
+			std::size_t lastRepairedNodes = 0;
+			// update in which every node was last repaired, to count every node once
+			std::vector<unsigned long long> repairedIn = {};
+
+			static bool isValidEdge(const Edge<T> *edge);
+			static double getWeight(const Edge<T> *edge);
+			std::size_t addNode(const Node<T> *node);
+			void insertArcs(const Edge<T> *edge);
+			void eraseArcs(const Edge<T> *edge);
+			void countEdge(const Edge<T> *edge, bool valid, int delta);
+			void setDistance(std::size_t node, double distance, std::size_t from, const Edge<T> *edge);
+			void beginUpdate();
+			void rebuild();
+			void propagate(min_heap &heap);
+			void decrease(const Edge<T> *edge);
+			void increase(const Edge<T> *edge);
+
+		public:
+			DynamicShortestPathTree(Graph<T> &graph, const Node<T> &source);
+			DynamicShortestPathTree(const DynamicShortestPathTree<T> &) = delete;
+			DynamicShortestPathTree<T> &operator=(const DynamicShortestPathTree<T> &) = delete;
+			~DynamicShortestPathTree();
+
+			/**
+			 * @brief Return true if every edge of the Graph is weighted and non negative
+			 */
+			bool isValid() const;
+			/**
+			 * @brief Return the error that makes the tree not valid, empty if it is valid
+			 */
+			std::string getErrorMessage() const;
+			/**
+			 * @brief Return the distance of node from the source, INF_DOUBLE if it is not reachable,
+			 * is not in the Graph or the tree is not valid
+			 */
+			double getDistance(const Node<T> &node) const;
+			/**
+			 * @brief Return the edges of the shortest path from the source to target, empty if
+			 * target is the source or getDistance(target) is INF_DOUBLE
+			 */
+			std::vector<const Edge<T> *> getPath(const Node<T> &target) const;
+			/**
+			 * @brief Return the number of modifications of the Graph handled by the tree
+			 */
+			unsigned long long getNumberOfUpdates() const;
+			/**
+			 * @brief Return the number of nodes whose distance was recomputed by the last update
+			 */
+			std::size_t getLastRepairedNodes() const;
+			/**
+			 * @brief Return the number of nodes whose distance was recomputed by all the updates
+			 */
+			unsigned long long getTotalRepairedNodes() const;
+
+			void onEdgeAdded(const Edge<T> *edge) override;
+			void onEdgeRemoved(const Edge<T> *edge) override;
+			void onEdgeWeightChanged(const Edge<T> *edge, double oldWeight) override;
+			void onEdgeSetChanged() override;
+			void onGraphDestroyed() override;
+		};
+
+		template <typename T>
+		DynamicShortestPathTree<T>::DynamicShortestPathTree(Graph<T> &graph, const Node<T> &source) : graph(&graph)
+		{
+			this->source = &source;
+			graph.attachObserver(this);
+			// the first build is not an update
+			rebuild();
+			lastRepairedNodes = 0;
+			totalRepairedNodes = 0;
+		}
+
+		template <typename T>
+		DynamicShortestPathTree<T>::~DynamicShortestPathTree()
+		{
+			if (graph)
+			{
+				graph->detachObserver(this);
+			}
+		}
+
+		template <typename T>
+		bool DynamicShortestPathTree<T>::isValidEdge(const Edge<T> *edge)
+		{
+			return edge->isWeighted().has_value() && edge->isWeighted().value() && getWeight(edge) >= 0;
+		}
+
+		template <typename T>
+		double DynamicShortestPathTree<T>::getWeight(const Edge<T> *edge)
+		{
+			return dynamic_cast<const Weighted *>(edge)->getWeight();
+		}
+
+		template <typename T>
+		std::size_t DynamicShortestPathTree<T>::addNode(const Node<T> *node)
+		{
+			auto it = nodeIndex.find(node);
+			if (it != nodeIndex.end())
+			{
+				return it->second;
+			}
+			nodeIndex[node] = nodes.size();
+			nodes.push_back(node);
+			outArcs.emplace_back();
+			inArcs.emplace_back();
+			dist.push_back(INF_DOUBLE);
+			parent.push_back(NO_PARENT);
+			parentEdge.push_back(nullptr);
+			inAffected.push_back(0);
+			repairedIn.push_back(0);
+			return nodes.size() - 1;
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::insertArcs(const Edge<T> *edge)
+		{
+			auto from = addNode(edge->getNodePair().first);
+			auto to = addNode(edge->getNodePair().second);
+			outArcs[from].push_back({to, edge});
+			inArcs[to].push_back({from, edge});
+			if (edge->isDirected().has_value() && !edge->isDirected().value())
+			{
+				outArcs[to].push_back({from, edge});
+				inArcs[from].push_back({to, edge});
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::eraseArcs(const Edge<T> *edge)
+		{
+			auto isEdge = [edge](const Arc &arc)
+			{ return arc.edge == edge; };
+			for (auto node : {edge->getNodePair().first, edge->getNodePair().second})
+			{
+				auto index = nodeIndex.at(node);
+				outArcs[index].erase(std::remove_if(outArcs[index].begin(), outArcs[index].end(), isEdge), outArcs[index].end());
+				inArcs[index].erase(std::remove_if(inArcs[index].begin(), inArcs[index].end(), isEdge), inArcs[index].end());
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::countEdge(const Edge<T> *edge, bool valid, int delta)
+		{
+			if (valid)
+			{
+				return;
+			}
+			if (edge->isWeighted().has_value() && edge->isWeighted().value())
+			{
+				negativeEdges += delta;
+			}
+			else
+			{
+				unweightedEdges += delta;
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::setDistance(std::size_t node, double distance, std::size_t from, const Edge<T> *edge)
+		{
+			dist[node] = distance;
+			parent[node] = from;
+			parentEdge[node] = edge;
+			if (repairedIn[node] != numberOfUpdates)
+			{
+				repairedIn[node] = numberOfUpdates;
+				++lastRepairedNodes;
+				++totalRepairedNodes;
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::beginUpdate()
+		{
+			++numberOfUpdates;
+			lastRepairedNodes = 0;
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::rebuild()
+		{
+			nodes.clear();
+			nodeIndex.clear();
+			outArcs.clear();
+			inArcs.clear();
+			dist.clear();
+			parent.clear();
+			parentEdge.clear();
+			inAffected.clear();
+			repairedIn.clear();
+			unweightedEdges = 0;
+			negativeEdges = 0;
+			addNode(source);
+			for (const auto &edge : graph->getEdgeSet())
+			{
+				insertArcs(edge);
+				countEdge(edge, isValidEdge(edge), 1);
+			}
+			if (!isValid())
+			{
+				return;
+			}
+			min_heap heap;
+			setDistance(0, 0.0, NO_PARENT, nullptr);
+			heap.push(std::make_pair(0.0, 0));
+			propagate(heap);
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::propagate(min_heap &heap)
+		{
+			while (!heap.empty())
+			{
+				auto [currentDist, node] = heap.top();
+				heap.pop();
+				if (currentDist > dist[node])
+				{
+					continue;
+				}
+				for (const auto &arc : outArcs[node])
+				{
+					auto distance = currentDist + getWeight(arc.edge);
+					if (distance < dist[arc.node])
+					{
+						setDistance(arc.node, distance, node, arc.edge);
+						heap.push(std::make_pair(distance, arc.node));
+					}
+				}
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::decrease(const Edge<T> *edge)
+		{
+			// only the nodes that get closer through the edge change, starting from its head
+			min_heap heap;
+			auto relax = [this, edge, &heap](std::size_t from, std::size_t to)
+			{
+				if (dist[from] != INF_DOUBLE && dist[from] + getWeight(edge) < dist[to])
+				{
+					setDistance(to, dist[from] + getWeight(edge), from, edge);
+					heap.push(std::make_pair(dist[to], to));
+				}
+			};
+			auto from = nodeIndex.at(edge->getNodePair().first);
+			auto to = nodeIndex.at(edge->getNodePair().second);
+			relax(from, to);
+			if (edge->isDirected().has_value() && !edge->isDirected().value())
+			{
+				relax(to, from);
+			}
+			propagate(heap);
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::increase(const Edge<T> *edge)
+		{
+			// the edge is in the tree at most once, as the parent edge of one of its endpoints
+			std::vector<std::size_t> affected;
+			for (auto node : {edge->getNodePair().first, edge->getNodePair().second})
+			{
+				auto index = nodeIndex.at(node);
+				if (parentEdge[index] == edge && !inAffected[index])
+				{
+					inAffected[index] = 1;
+					affected.push_back(index);
+				}
+			}
+			// all the subtree below the edge loses its distance
+			for (std::size_t i = 0; i < affected.size(); ++i)
+			{
+				for (const auto &arc : outArcs[affected[i]])
+				{
+					if (parentEdge[arc.node] == arc.edge && parent[arc.node] == affected[i] && !inAffected[arc.node])
+					{
+						inAffected[arc.node] = 1;
+						affected.push_back(arc.node);
+					}
+				}
+			}
+			for (auto node : affected)
+			{
+				setDistance(node, INF_DOUBLE, NO_PARENT, nullptr);
+			}
+			// and is reconnected from the nodes around it, whose distance did not change
+			min_heap heap;
+			for (auto node : affected)
+			{
+				for (const auto &arc : inArcs[node])
+				{
+					if (!inAffected[arc.node] && dist[arc.node] != INF_DOUBLE && dist[arc.node] + getWeight(arc.edge) < dist[node])
+					{
+						setDistance(node, dist[arc.node] + getWeight(arc.edge), arc.node, arc.edge);
+					}
+				}
+				if (dist[node] != INF_DOUBLE)
+				{
+					heap.push(std::make_pair(dist[node], node));
+				}
+			}
+			for (auto node : affected)
+			{
+				inAffected[node] = 0;
+			}
+			propagate(heap);
+		}
+
+		template <typename T>
+		bool DynamicShortestPathTree<T>::isValid() const
+		{
+			return unweightedEdges == 0 && negativeEdges == 0;
+		}
+
+		template <typename T>
+		std::string DynamicShortestPathTree<T>::getErrorMessage() const
+		{
+			if (unweightedEdges > 0)
+			{
+				return ERR_NO_WEIGHTED_EDGE;
+			}
+			if (negativeEdges > 0)
+			{
+				return ERR_NEGATIVE_WEIGHTED_EDGE;
+			}
+			return "";
+		}
+
+		template <typename T>
+		double DynamicShortestPathTree<T>::getDistance(const Node<T> &node) const
+		{
+			auto it = nodeIndex.find(&node);
+			if (!isValid() || it == nodeIndex.end())
+			{
+				return INF_DOUBLE;
+			}
+			return dist[it->second];
+		}
+
+		template <typename T>
+		std::vector<const Edge<T> *> DynamicShortestPathTree<T>::getPath(const Node<T> &target) const
+		{
+			std::vector<const Edge<T> *> path;
+			if (getDistance(target) == INF_DOUBLE)
+			{
+				return path;
+			}
+			for (auto node = nodeIndex.at(&target); parent[node] != NO_PARENT; node = parent[node])
+			{
+				path.push_back(parentEdge[node]);
+			}
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+
+		template <typename T>
+		unsigned long long DynamicShortestPathTree<T>::getNumberOfUpdates() const
+		{
+			return numberOfUpdates;
+		}
+
+		template <typename T>
+		std::size_t DynamicShortestPathTree<T>::getLastRepairedNodes() const
+		{
+			return lastRepairedNodes;
+		}
+
+		template <typename T>
+		unsigned long long DynamicShortestPathTree<T>::getTotalRepairedNodes() const
+		{
+			return totalRepairedNodes;
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::onEdgeAdded(const Edge<T> *edge)
+		{
+			beginUpdate();
+			auto wasValid = isValid();
+			insertArcs(edge);
+			countEdge(edge, isValidEdge(edge), 1);
+			// while the tree is not valid the arcs are kept up to date, and the tree is rebuilt when it becomes valid
+			if (wasValid && isValid())
+			{
+				decrease(edge);
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::onEdgeRemoved(const Edge<T> *edge)
+		{
+			beginUpdate();
+			auto wasValid = isValid();
+			eraseArcs(edge);
+			countEdge(edge, isValidEdge(edge), -1);
+			if (wasValid)
+			{
+				increase(edge);
+			}
+			else if (isValid())
+			{
+				rebuild();
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::onEdgeWeightChanged(const Edge<T> *edge, double oldWeight)
+		{
+			beginUpdate();
+			auto wasValid = isValid();
+			countEdge(edge, oldWeight >= 0, -1);
+			countEdge(edge, isValidEdge(edge), 1);
+			if (!isValid())
+			{
+				return;
+			}
+			if (!wasValid)
+			{
+				rebuild();
+			}
+			else if (getWeight(edge) < oldWeight)
+			{
+				decrease(edge);
+			}
+			else if (getWeight(edge) > oldWeight)
+			{
+				increase(edge);
+			}
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::onEdgeSetChanged()
+		{
+			beginUpdate();
+			rebuild();
+		}
+
+		template <typename T>
+		void DynamicShortestPathTree<T>::onGraphDestroyed()
+		{
+			graph = nullptr;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_DYNAMICSHORTESTPATHTREE_H__
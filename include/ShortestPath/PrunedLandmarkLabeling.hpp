@@ -0,0 +1,636 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_PRUNEDLANDMARKLABELING_H__
+#define __CXXGRAPH_SHORTESTPATH_PRUNEDLANDMARKLABELING_H__
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <deque>
+#include <optional>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <chrono>
+#include <fstream>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include "Graph/Graph.hpp"
+#include "Graph/CSRGraph.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ConstString.hpp"
+#include "Utility/Typedef.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/// Class that implement a 2-hop labeling distance oracle built by Pruned Landmark Labeling.
+		/// Every node has a label of (hub, distance) pairs sorted by hub, and the distance between two
+		/// nodes is the minimum over the hubs in common, found by merging the two labels. The hubs are
+		/// the nodes in order of decreasing degree: a search from every hub adds it to the labels of the
+		/// nodes it reaches, and is pruned at the nodes whose distance is already given by the labels.
+		/// Unweighted graphs are searched by BFS, weighted graphs by Dijkstra; a directed graph has an
+		/// out label and an in label for every node. The Graph must not be modified after the construction.
+		/// ( This class is not Thread Safe during the build, it is safe for concurrent queries )
+		template <typename T>
+		class PrunedLandmarkLabeling
+		{
+		private:
+			/// labels of all the nodes stored contiguously, the label of v is in [offset[v], offset[v + 1])
+			struct Labels
+			{
+				std::vector<uint64_t> offset = {0};
+				std::vector<uint32_t> hub = {};
+				std::vector<double> distance = {};
+			};
+
+			CSRGraph<T> csr;
+			bool built = false;
+			bool symmetric = false;
+			std::string errorMessage = "";
+			double preprocessingTime = 0.0;
+			std::vector<std::size_t> rank = {};
+			// distance from every node to its hubs
+			Labels outLabels;
+			// distance from the hubs to every node, not used if the graph is undirected
+			Labels inLabels;
+
+			void prunedSearch(std::size_t root, uint32_t hub, bool unitWeights, bool forward,
+							  std::vector<std::vector<std::pair<uint32_t, double>>> &rootLabels,
+							  std::vector<std::vector<std::pair<uint32_t, double>>> &reachedLabels,
+							  std::vector<double> &rootDistance, std::vector<double> &dist) const;
+			static void flatten(std::vector<std::vector<std::pair<uint32_t, double>>> &working, Labels &labels);
+			double distance(std::size_t source, std::size_t target) const;
+			template <typename V>
+			static void writeVector(std::ofstream &ofs, const std::vector<V> &vector);
+			template <typename V>
+			static bool readVector(std::ifstream &ifs, std::vector<V> &vector);
+
+		public:
+			PrunedLandmarkLabeling(const Graph<T> &graph);
+			~PrunedLandmarkLabeling() = default;
+			/**
+			 * @brief Function that compute the labels of all the nodes
+			 * Note: No Thread Safe
+			 *
+			 * @return 0 if all OK, else return a negative value and the error is reported by getErrorMessage()
+			 */
+			int build();
+			/**
+			 * @brief Function that return the shortest distance between source and target merging their labels
+			 *
+			 * @param source source vertex
+			 * @param target target vertex
+			 *
+			 * @return shortest distance if target is reachable from source else ERROR in
+			 * case if target is not reachable from source or there is error in the computation.
+			 */
+			const DijkstraResult query(const Node<T> &source, const Node<T> &target) const;
+			/**
+			 * @brief Function that write the labels in a binary file named OFileName.pll
+			 *
+			 * @param workingDir The path to the directory in which will be placed the output file
+			 * @param OFileName The Output File Name
+			 * @return 0 if all OK, else return a negative value
+			 */
+			int writeToFile(const std::string &workingDir = ".", const std::string &OFileName = "graph") const;
+			/**
+			 * @brief Function that read the labels written by writeToFile. The nodes are matched by user id
+			 * with the nodes of the graph given at the construction.
+			 *
+			 * @param workingDir The path to the directory in which is placed the input file
+			 * @param OFileName The Input File Name
+			 * @return 0 if all OK, else return a negative value
+			 */
+			int readFromFile(const std::string &workingDir = ".", const std::string &OFileName = "graph");
+
+			bool isBuilt() const;
+			const std::string &getErrorMessage() const;
+			/**
+			 * @brief Return the time spent in the last build() in milliseconds
+			 */
+			double getPreprocessingTime() const;
+			/**
+			 * @brief Return the number of entries of the labels of node (out and in labels for a directed graph)
+			 */
+			std::size_t getLabelSize(const Node<T> &node) const;
+			/**
+			 * @brief Return the average number of label entries per node
+			 */
+			double getAverageLabelSize() const;
+			/**
+			 * @brief Return the size in bytes of the labels
+			 */
+			std::size_t getMemorySize() const;
+		};
+
+		template <typename T>
+		PrunedLandmarkLabeling<T>::PrunedLandmarkLabeling(const Graph<T> &graph) : csr(graph.getEdgeSet())
+		{
+		}
+
+		template <typename T>
+		void PrunedLandmarkLabeling<T>::prunedSearch(std::size_t root, uint32_t hub, bool unitWeights, bool forward,
+													 std::vector<std::vector<std::pair<uint32_t, double>>> &rootLabels,
+													 std::vector<std::vector<std::pair<uint32_t, double>>> &reachedLabels,
+													 std::vector<double> &rootDistance, std::vector<double> &dist) const
+		{
+			using pq_type = std::pair<double, std::size_t>;
+			const auto &offset = forward ? csr.getOutOffset() : csr.getInOffset();
+			const auto &adjacency = forward ? csr.getOutTarget() : csr.getInSource();
+			const auto &weight = forward ? csr.getOutWeight() : csr.getInWeight();
+
+			// the distances between root and the previous hubs, to bound the distance of every node in O(|label|)
+			for (const auto &[h, d] : rootLabels[root])
+			{
+				rootDistance[h] = d;
+			}
+			std::vector<std::size_t> touched = {root};
+			dist[root] = 0;
+			// unweighted graphs are searched by BFS, the queue is always sorted by distance
+			std::deque<std::size_t> queue;
+			std::priority_queue<pq_type, std::vector<pq_type>, std::greater<pq_type>> pq;
+			if (unitWeights)
+			{
+				queue.push_back(root);
+			}
+			else
+			{
+				pq.push(std::make_pair(0.0, root));
+			}
+			while (unitWeights ? !queue.empty() : !pq.empty())
+			{
+				std::size_t node;
+				if (unitWeights)
+				{
+					node = queue.front();
+					queue.pop_front();
+				}
+				else
+				{
+					auto top = pq.top();
+					pq.pop();
+					node = top.second;
+					if (top.first > dist[node])
+					{
+						continue;
+					}
+				}
+				// prune if the labels already give a path not longer than the one found
+				bool pruned = false;
+				for (const auto &[h, d] : reachedLabels[node])
+				{
+					if (rootDistance[h] != INF_DOUBLE && rootDistance[h] + d <= dist[node])
+					{
+						pruned = true;
+						break;
+					}
+				}
+				if (pruned)
+				{
+					continue;
+				}
+				reachedLabels[node].emplace_back(hub, dist[node]);
+				for (auto arc = offset[node]; arc < offset[node + 1]; ++arc)
+				{
+					auto next = adjacency[arc];
+					auto nextDist = dist[node] + (unitWeights ? 1.0 : weight[arc]);
+					if (nextDist < dist[next])
+					{
+						if (dist[next] == INF_DOUBLE)
+						{
+							touched.push_back(next);
+						}
+						dist[next] = nextDist;
+						if (unitWeights)
+						{
+							queue.push_back(next);
+						}
+						else
+						{
+							pq.push(std::make_pair(nextDist, next));
+						}
+					}
+				}
+			}
+			for (auto node : touched)
+			{
+				dist[node] = INF_DOUBLE;
+			}
+			for (const auto &[h, d] : rootLabels[root])
+			{
+				rootDistance[h] = INF_DOUBLE;
+			}
+		}
+
+		template <typename T>
+		void PrunedLandmarkLabeling<T>::flatten(std::vector<std::vector<std::pair<uint32_t, double>>> &working, Labels &labels)
+		{
+			labels = Labels();
+			for (auto &label : working)
+			{
+				for (const auto &[h, d] : label)
+				{
+					labels.hub.push_back(h);
+					labels.distance.push_back(d);
+				}
+				labels.offset.push_back(labels.hub.size());
+				std::vector<std::pair<uint32_t, double>>().swap(label);
+			}
+		}
+
+		template <typename T>
+		int PrunedLandmarkLabeling<T>::build()
+		{
+			auto start = std::chrono::steady_clock::now();
+			built = false;
+			errorMessage = "";
+			const auto n = csr.getNumberOfNodes();
+			const auto &edgeWeighted = csr.getEdgeWeighted();
+			const auto &edgeWeight = csr.getEdgeWeight();
+			auto weightedEdges = std::count(edgeWeighted.begin(), edgeWeighted.end(), 1);
+			if (weightedEdges != 0 && static_cast<std::size_t>(weightedEdges) != csr.getNumberOfEdges())
+			{
+				// a mix of weighted and unweighted edges has no meaningful distance
+				errorMessage = ERR_NO_WEIGHTED_EDGE;
+				return -1;
+			}
+			if (std::any_of(edgeWeight.begin(), edgeWeight.end(), [](double weight)
+							{ return weight < 0; }))
+			{
+				errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+				return -1;
+			}
+			const bool unitWeights = weightedEdges == 0;
+			symmetric = csr.isUndirected();
+
+			// the nodes of higher degree cover more shortest paths and are the first hubs
+			std::vector<std::size_t> order(n);
+			std::iota(order.begin(), order.end(), 0);
+			std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b)
+							 { return csr.getOutDegree(a) + csr.getInDegree(a) > csr.getOutDegree(b) + csr.getInDegree(b); });
+			rank.assign(n, 0);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				rank[order[i]] = i;
+			}
+
+			std::vector<std::vector<std::pair<uint32_t, double>>> outWorking(n), inWorking(symmetric ? 0 : n);
+			auto &inRef = symmetric ? outWorking : inWorking;
+			std::vector<double> rootDistance(n, INF_DOUBLE), dist(n, INF_DOUBLE);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				auto hub = static_cast<uint32_t>(i);
+				// the forward search adds the hub to the in labels of the nodes reachable from it,
+				// the backward search to the out labels of the nodes that reach it
+				prunedSearch(order[i], hub, unitWeights, true, outWorking, inRef, rootDistance, dist);
+				if (!symmetric)
+				{
+					prunedSearch(order[i], hub, unitWeights, false, inWorking, outWorking, rootDistance, dist);
+				}
+			}
+			flatten(outWorking, outLabels);
+			if (symmetric)
+			{
+				inLabels = Labels();
+			}
+			else
+			{
+				flatten(inWorking, inLabels);
+			}
+			built = true;
+			preprocessingTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			return 0;
+		}
+
+		template <typename T>
+		double PrunedLandmarkLabeling<T>::distance(std::size_t source, std::size_t target) const
+		{
+			const auto &in = symmetric ? outLabels : inLabels;
+			auto i = outLabels.offset[source], iEnd = outLabels.offset[source + 1];
+			auto j = in.offset[target], jEnd = in.offset[target + 1];
+			double best = INF_DOUBLE;
+			while (i < iEnd && j < jEnd)
+			{
+				if (outLabels.hub[i] == in.hub[j])
+				{
+					best = std::min(best, outLabels.distance[i] + in.distance[j]);
+					++i;
+					++j;
+				}
+				else if (outLabels.hub[i] < in.hub[j])
+				{
+					++i;
+				}
+				else
+				{
+					++j;
+				}
+			}
+			return best;
+		}
+
+		template <typename T>
+		const DijkstraResult PrunedLandmarkLabeling<T>::query(const Node<T> &source, const Node<T> &target) const
+		{
+			DijkstraResult result;
+			if (!built)
+			{
+				result.errorMessage = ERR_PLL_NOT_BUILT;
+				return result;
+			}
+			auto sourceIndex = csr.getIndex(&source);
+			if (!sourceIndex.has_value())
+			{
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			auto targetIndex = csr.getIndex(&target);
+			if (!targetIndex.has_value())
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			auto d = distance(sourceIndex.value(), targetIndex.value());
+			if (d == INF_DOUBLE)
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+				return result;
+			}
+			result.success = true;
+			result.result = d;
+			return result;
+		}
+
+		template <typename T>
+		template <typename V>
+		void PrunedLandmarkLabeling<T>::writeVector(std::ofstream &ofs, const std::vector<V> &vector)
+		{
+			uint64_t size = vector.size();
+			ofs.write(reinterpret_cast<const char *>(&size), sizeof(size));
+			ofs.write(reinterpret_cast<const char *>(vector.data()), size * sizeof(V));
+		}
+
+		template <typename T>
+		template <typename V>
+		bool PrunedLandmarkLabeling<T>::readVector(std::ifstream &ifs, std::vector<V> &vector)
+		{
+			uint64_t size = 0;
+			if (!ifs.read(reinterpret_cast<char *>(&size), sizeof(size)))
+			{
+				return false;
+			}
+			// refuse sizes that the rest of the file cannot hold before allocating
+			auto position = ifs.tellg();
+			ifs.seekg(0, std::ios::end);
+			auto end = ifs.tellg();
+			ifs.seekg(position);
+			if (!ifs || position < 0 || end < position || size > static_cast<uint64_t>(end - position) / sizeof(V))
+			{
+				return false;
+			}
+			vector.resize(size);
+			return static_cast<bool>(ifs.read(reinterpret_cast<char *>(vector.data()), size * sizeof(V)));
+		}
+
+		template <typename T>
+		int PrunedLandmarkLabeling<T>::writeToFile(const std::string &workingDir, const std::string &OFileName) const
+		{
+			if (!built)
+			{
+				return -1;
+			}
+			std::ofstream ofs(workingDir + "/" + OFileName + ".pll", std::ios::binary);
+			if (!ofs.is_open())
+			{
+				// ERROR File Not Open
+				return -1;
+			}
+			ofs.write(PLL_FILE_MAGIC, sizeof(PLL_FILE_MAGIC));
+			uint64_t n = csr.getNumberOfNodes();
+			uint8_t isSymmetric = symmetric ? 1 : 0;
+			ofs.write(reinterpret_cast<const char *>(&n), sizeof(n));
+			ofs.write(reinterpret_cast<const char *>(&isSymmetric), sizeof(isSymmetric));
+			for (const auto &node : csr.getNodes())
+			{
+				uint64_t length = node->getUserId().size();
+				ofs.write(reinterpret_cast<const char *>(&length), sizeof(length));
+				ofs.write(node->getUserId().data(), length);
+			}
+			std::vector<uint64_t> buffer(rank.begin(), rank.end());
+			writeVector(ofs, buffer);
+			for (const auto *labels : {&outLabels, &inLabels})
+			{
+				writeVector(ofs, labels->offset);
+				writeVector(ofs, labels->hub);
+				writeVector(ofs, labels->distance);
+			}
+			return ofs.good() ? 0 : -1;
+		}
+
+		template <typename T>
+		int PrunedLandmarkLabeling<T>::readFromFile(const std::string &workingDir, const std::string &OFileName)
+		{
+			std::ifstream ifs(workingDir + "/" + OFileName + ".pll", std::ios::binary);
+			if (!ifs.is_open())
+			{
+				// ERROR File Not Open
+				return -1;
+			}
+			char magic[sizeof(PLL_FILE_MAGIC)];
+			if (!ifs.read(magic, sizeof(magic)) || std::string(magic, sizeof(magic)) != std::string(PLL_FILE_MAGIC, sizeof(PLL_FILE_MAGIC)))
+			{
+				return -1;
+			}
+			uint64_t n = 0;
+			uint8_t isSymmetric = 0;
+			ifs.read(reinterpret_cast<char *>(&n), sizeof(n));
+			ifs.read(reinterpret_cast<char *>(&isSymmetric), sizeof(isSymmetric));
+			if (!ifs || n != csr.getNumberOfNodes())
+			{
+				return -1;
+			}
+			// match the nodes of the file with the nodes of the graph by user id
+			std::unordered_map<std::string, std::size_t> userIdToIndex;
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				userIdToIndex[csr.getNode(i)->getUserId()] = i;
+			}
+			std::vector<std::size_t> permutation(n);
+			std::vector<bool> matched(n, false);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				std::vector<char> userId;
+				if (!readVector(ifs, userId))
+				{
+					return -1;
+				}
+				auto it = userIdToIndex.find(std::string(userId.begin(), userId.end()));
+				if (it == userIdToIndex.end() || matched[it->second])
+				{
+					// unknown or duplicated user id
+					return -1;
+				}
+				matched[it->second] = true;
+				permutation[i] = it->second;
+			}
+			std::vector<uint64_t> fileRank;
+			Labels fileLabels[2];
+			if (!readVector(ifs, fileRank) || fileRank.size() != n)
+			{
+				return -1;
+			}
+			for (auto &labels : fileLabels)
+			{
+				if (!readVector(ifs, labels.offset) || !readVector(ifs, labels.hub) || !readVector(ifs, labels.distance) ||
+					labels.hub.size() != labels.distance.size() || labels.offset.empty() ||
+					labels.offset.front() != 0 || labels.offset.back() != labels.hub.size())
+				{
+					return -1;
+				}
+				// every label must be a valid range and every hub the rank of a node
+				for (std::size_t i = 0; i + 1 < labels.offset.size(); ++i)
+				{
+					if (labels.offset[i] > labels.offset[i + 1])
+					{
+						return -1;
+					}
+				}
+				for (auto hub : labels.hub)
+				{
+					if (hub >= n)
+					{
+						return -1;
+					}
+				}
+				// the hubs of a label must be strictly increasing, the query merges the labels in that order
+				for (std::size_t i = 0; i + 1 < labels.offset.size(); ++i)
+				{
+					for (auto entry = labels.offset[i] + 1; entry < labels.offset[i + 1]; ++entry)
+					{
+						if (labels.hub[entry - 1] >= labels.hub[entry])
+						{
+							return -1;
+						}
+					}
+				}
+			}
+			if (fileLabels[0].offset.size() != n + 1 || (!isSymmetric && fileLabels[1].offset.size() != n + 1))
+			{
+				return -1;
+			}
+
+			// the hubs are ranks and do not depend on the node indices, only the labels are permuted
+			std::vector<std::size_t> inverse(n);
+			rank.assign(n, 0);
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				rank[permutation[i]] = fileRank[i];
+				inverse[permutation[i]] = i;
+			}
+			auto permute = [&inverse, n](const Labels &fileLabel, Labels &label)
+			{
+				label = Labels();
+				for (std::size_t v = 0; v < n; ++v)
+				{
+					auto i = inverse[v];
+					label.hub.insert(label.hub.end(), fileLabel.hub.begin() + fileLabel.offset[i], fileLabel.hub.begin() + fileLabel.offset[i + 1]);
+					label.distance.insert(label.distance.end(), fileLabel.distance.begin() + fileLabel.offset[i], fileLabel.distance.begin() + fileLabel.offset[i + 1]);
+					label.offset.push_back(label.hub.size());
+				}
+			};
+			symmetric = isSymmetric != 0;
+			permute(fileLabels[0], outLabels);
+			if (symmetric)
+			{
+				inLabels = Labels();
+			}
+			else
+			{
+				permute(fileLabels[1], inLabels);
+			}
+			built = true;
+			errorMessage = "";
+			return 0;
+		}
+
+		template <typename T>
+		bool PrunedLandmarkLabeling<T>::isBuilt() const
+		{
+			return built;
+		}
+
+		template <typename T>
+		const std::string &PrunedLandmarkLabeling<T>::getErrorMessage() const
+		{
+			return errorMessage;
+		}
+
+		template <typename T>
+		double PrunedLandmarkLabeling<T>::getPreprocessingTime() const
+		{
+			return preprocessingTime;
+		}
+
+		template <typename T>
+		std::size_t PrunedLandmarkLabeling<T>::getLabelSize(const Node<T> &node) const
+		{
+			auto index = csr.getIndex(&node);
+			if (!built || !index.has_value())
+			{
+				return 0;
+			}
+			auto v = index.value();
+			auto size = outLabels.offset[v + 1] - outLabels.offset[v];
+			if (!symmetric)
+			{
+				size += inLabels.offset[v + 1] - inLabels.offset[v];
+			}
+			return size;
+		}
+
+		template <typename T>
+		double PrunedLandmarkLabeling<T>::getAverageLabelSize() const
+		{
+			if (!built || csr.getNumberOfNodes() == 0)
+			{
+				return 0.0;
+			}
+			return static_cast<double>(outLabels.hub.size() + inLabels.hub.size()) / csr.getNumberOfNodes();
+		}
+
+		template <typename T>
+		std::size_t PrunedLandmarkLabeling<T>::getMemorySize() const
+		{
+			std::size_t size = 0;
+			for (const auto *labels : {&outLabels, &inLabels})
+			{
+				size += labels->offset.size() * sizeof(uint64_t) + labels->hub.size() * sizeof(uint32_t) + labels->distance.size() * sizeof(double);
+			}
+			return size;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_PRUNEDLANDMARKLABELING_H__
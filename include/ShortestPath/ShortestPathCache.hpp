@@ -0,0 +1,538 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_SHORTESTPATHCACHE_H__
+#define __CXXGRAPH_SHORTESTPATH_SHORTESTPATHCACHE_H__
+
+#pragma once
+
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <limits>
+#include <string>
+
+#include "Graph/Graph.hpp"
+#include "Graph/CSRGraph.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "ShortestPath/CSRBellmanFord.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ConstString.hpp"
+#include "Utility/Typedef.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/// Struct that contains a shortest path tree computed from a source node
+		template <typename T>
+		struct ShortestPathTree_struct
+		{
+			std::string errorMessage = "";						 // message of error, empty if the tree is valid
+			bool negativeCycle = false;							 // TRUE if a negative cycle is reachable from the source (Bellman-Ford only)
+			std::shared_ptr<const CSRGraph<T>> csr = nullptr;	 // snapshot of the graph that gives the dense index of the nodes
+			std::size_t source = 0;								 // dense index of the source node
+			std::vector<double> distances = {};					 // distance of every node from the source, INF_DOUBLE if not reachable
+			std::vector<std::size_t> parent = {};				 // previous node on the shortest path, NO_PARENT for the source and the unreachable nodes
+			std::vector<const Edge<T> *> parentEdge = {};		 // edge from the previous node, nullptr for the source and the unreachable nodes
+
+			/**
+			 * @brief Return the distance of target from the source, INF_DOUBLE if it is not reachable or not in the graph
+			 */
+			double getDistance(const Node<T> &target) const;
+			/**
+			 * @brief Return the edges of the shortest path from the source to target, empty if
+			 * target is the source, is not reachable or the tree is not valid
+			 */
+			std::vector<const Edge<T> *> getPath(const Node<T> &target) const;
+			/**
+			 * @brief Return the size in bytes of the tree (the graph snapshot is shared and not counted)
+			 */
+			std::size_t getMemorySize() const;
+		};
+		template <typename T>
+		using ShortestPathTree = ShortestPathTree_struct<T>;
+
+		/// Class that implement a LRU cache of the shortest path trees of a Graph, keyed by
+		/// source node, algorithm and version of the graph.
+		/// Every setEdgeSet, addEdge or removeEdge on the graph changes its version, and the
+		/// next query on the cache drops all the trees computed on the previous version.
+		/// The memory of the cached trees is bounded by a byte budget, the least recently
+		/// used trees are evicted first.
+		/// ( This class is Thread Safe for concurrent queries, the Graph must not be modified during a query )
+		template <typename T>
+		class ShortestPathCache
+		{
+		private:
+			struct Key
+			{
+				const Node<T> *source;
+				ShortestPathAlgorithm algorithm;
+				unsigned long long version;
+
+				bool operator==(const Key &other) const
+				{
+					return source == other.source && algorithm == other.algorithm && version == other.version;
+				}
+			};
+			struct KeyHash
+			{
+				std::size_t operator()(const Key &key) const
+				{
+					std::size_t seed = std::hash<const Node<T> *>()(key.source);
+					seed = hash_combine(seed, static_cast<std::size_t>(key.algorithm));
+					seed = hash_combine(seed, std::hash<unsigned long long>()(key.version));
+					return seed;
+				}
+			};
+			using Entry = std::pair<Key, std::shared_ptr<const ShortestPathTree<T>>>;
+
+			const Graph<T> &graph;
+			std::size_t byteBudget = 0;
+			std::size_t memoryUsage = 0;
+			unsigned long long hits = 0;
+			unsigned long long misses = 0;
+			unsigned long long evictions = 0;
+			unsigned long long version = 0;
+			std::shared_ptr<const CSRGraph<T>> csr = nullptr;
+			// most recently used tree at the front
+			std::list<Entry> lru = {};
+			std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index = {};
+			mutable std::mutex mutex;
+
+			void refresh();
+			void evict();
+			static std::shared_ptr<ShortestPathTree<T>> compute(const std::shared_ptr<const CSRGraph<T>> &csr, std::size_t source, ShortestPathAlgorithm algorithm);
+
+		public:
+			ShortestPathCache(const Graph<T> &graph, std::size_t byteBudget = SP_CACHE_DEFAULT_BYTE_BUDGET);
+			~ShortestPathCache() = default;
+			/**
+			 * @brief Function that return the shortest path tree of source computed with algorithm,
+			 * from the cache if present, else the tree is computed and inserted in the cache.
+			 * A tree larger than the byte budget is returned but not cached.
+			 * Note: Thread Safe
+			 *
+			 * @param source source vertex
+			 * @param algorithm algorithm used to compute the tree
+			 *
+			 * @return the tree, nullptr if source is not in the graph
+			 */
+			std::shared_ptr<const ShortestPathTree<T>> getTree(const Node<T> &source, ShortestPathAlgorithm algorithm);
+			/**
+			 * @brief Same result of Graph::dijkstra, computed on the cached tree of source
+			 * Note: Thread Safe
+			 */
+			const DijkstraResult dijkstra(const Node<T> &source, const Node<T> &target);
+			/**
+			 * @brief Same result of Graph::bellmanford, computed on the cached tree of source
+			 * Note: Thread Safe
+			 */
+			const BellmanFordResult bellmanford(const Node<T> &source, const Node<T> &target);
+			/**
+			 * @brief Same result of Graph::dial, computed on the cached tree of source.
+			 * The buckets of Dial's algorithm give the same distances of Dijkstra on the
+			 * truncated weights, so the tree does not depend on maxWeight: it is accepted
+			 * only for the same signature of Graph::dial and is not used.
+			 * Note: Thread Safe
+			 */
+			const DialResult dial(const Node<T> &source, int maxWeight);
+
+			/**
+			 * @brief Return the number of queries answered by a cached tree
+			 */
+			unsigned long long getHits() const;
+			/**
+			 * @brief Return the number of queries that computed a new tree
+			 */
+			unsigned long long getMisses() const;
+			/**
+			 * @brief Return the number of trees evicted to stay in the byte budget
+			 */
+			unsigned long long getEvictions() const;
+			/**
+			 * @brief Return the size in bytes of the cached trees
+			 */
+			std::size_t getMemoryUsage() const;
+			std::size_t getByteBudget() const;
+			/**
+			 * @brief Set the byte budget, evicting the least recently used trees if needed
+			 */
+			void setByteBudget(std::size_t byteBudget);
+			/**
+			 * @brief Remove all the cached trees, the counters are not reset
+			 */
+			void clear();
+		};
+
+		template <typename T>
+		double ShortestPathTree_struct<T>::getDistance(const Node<T> &target) const
+		{
+			if (!csr || !errorMessage.empty() || negativeCycle)
+			{
+				return INF_DOUBLE;
+			}
+			auto targetIndex = csr->getIndex(&target);
+			if (!targetIndex.has_value())
+			{
+				return INF_DOUBLE;
+			}
+			return distances[targetIndex.value()];
+		}
+
+		template <typename T>
+		std::vector<const Edge<T> *> ShortestPathTree_struct<T>::getPath(const Node<T> &target) const
+		{
+			std::vector<const Edge<T> *> path;
+			if (getDistance(target) == INF_DOUBLE)
+			{
+				return path;
+			}
+			for (auto node = csr->getIndex(&target).value(); parent[node] != NO_PARENT; node = parent[node])
+			{
+				path.push_back(parentEdge[node]);
+			}
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+
+		template <typename T>
+		std::size_t ShortestPathTree_struct<T>::getMemorySize() const
+		{
+			return sizeof(ShortestPathTree_struct<T>) + errorMessage.capacity() +
+				   distances.capacity() * sizeof(double) +
+				   parent.capacity() * sizeof(std::size_t) +
+				   parentEdge.capacity() * sizeof(const Edge<T> *);
+		}
+
+		template <typename T>
+		ShortestPathCache<T>::ShortestPathCache(const Graph<T> &graph, std::size_t byteBudget) : graph(graph)
+		{
+			this->byteBudget = byteBudget;
+		}
+
+		template <typename T>
+		void ShortestPathCache<T>::refresh()
+		{
+			// the trees of an old version are never hit again
+			if (!csr || version != graph.getVersion())
+			{
+				lru.clear();
+				index.clear();
+				memoryUsage = 0;
+				version = graph.getVersion();
+				csr = std::make_shared<const CSRGraph<T>>(graph.getEdgeSet());
+			}
+		}
+
+		template <typename T>
+		void ShortestPathCache<T>::evict()
+		{
+			while (memoryUsage > byteBudget && !lru.empty())
+			{
+				memoryUsage -= lru.back().second->getMemorySize();
+				index.erase(lru.back().first);
+				lru.pop_back();
+				++evictions;
+			}
+		}
+
+		template <typename T>
+		std::shared_ptr<ShortestPathTree<T>> ShortestPathCache<T>::compute(const std::shared_ptr<const CSRGraph<T>> &csr, std::size_t source, ShortestPathAlgorithm algorithm)
+		{
+			auto tree = std::make_shared<ShortestPathTree<T>>();
+			tree->csr = csr;
+			tree->source = source;
+			const auto n = csr->getNumberOfNodes();
+			const auto &edges = csr->getEdges();
+			const auto &edgeFrom = csr->getEdgeFrom();
+			const auto &edgeTo = csr->getEdgeTo();
+			const auto &outOffset = csr->getOutOffset();
+			const auto &outTarget = csr->getOutTarget();
+			const auto &outEdge = csr->getOutEdge();
+			std::vector<std::size_t> parentEdgeIndex;
+
+			if (algorithm == SP_BELLMAN_FORD)
+			{
+				if (!csr->isWeighted())
+				{
+					tree->errorMessage = ERR_NO_WEIGHTED_EDGE;
+					return tree;
+				}
+				tree->distances.assign(n, INF_DOUBLE);
+				tree->distances[source] = 0;
+				tree->negativeCycle = csrBellmanFord(*csr, tree->distances, {source}, 1, &tree->parent, &parentEdgeIndex);
+			}
+			else
+			{
+				// Dial's algorithm works on the weights truncated to integers
+				std::vector<double> weight(csr->getOutWeight());
+				if (algorithm == SP_DIAL)
+				{
+					for (auto &w : weight)
+					{
+						w = static_cast<double>(static_cast<long>(w));
+					}
+				}
+				// like dijkstra and dial, only the edges reachable from the source must be weighted and non negative
+				const auto &edgeWeighted = csr->getEdgeWeighted();
+				std::vector<char> reached(n, 0);
+				std::vector<std::size_t> stack = {source};
+				reached[source] = 1;
+				while (!stack.empty())
+				{
+					auto node = stack.back();
+					stack.pop_back();
+					for (auto arc = outOffset[node]; arc < outOffset[node + 1]; ++arc)
+					{
+						if (!edgeWeighted[outEdge[arc]])
+						{
+							tree->errorMessage = ERR_NO_WEIGHTED_EDGE;
+							return tree;
+						}
+						if (weight[arc] < 0)
+						{
+							tree->errorMessage = ERR_NEGATIVE_WEIGHTED_EDGE;
+							return tree;
+						}
+						if (!reached[outTarget[arc]])
+						{
+							reached[outTarget[arc]] = 1;
+							stack.push_back(outTarget[arc]);
+						}
+					}
+				}
+				std::vector<std::size_t> parentArc;
+				csrDijkstra(outOffset, outTarget, weight, source, tree->distances, nullptr, &parentArc);
+				tree->parent.assign(n, NO_PARENT);
+				parentEdgeIndex.assign(n, NO_PARENT);
+				for (std::size_t node = 0; node < n; ++node)
+				{
+					if (parentArc[node] != NO_PARENT)
+					{
+						auto edge = outEdge[parentArc[node]];
+						parentEdgeIndex[node] = edge;
+						// an undirected edge is traversed in both directions
+						tree->parent[node] = edgeTo[edge] == node ? edgeFrom[edge] : edgeTo[edge];
+					}
+				}
+			}
+
+			tree->parentEdge.assign(n, nullptr);
+			for (std::size_t node = 0; node < n; ++node)
+			{
+				if (parentEdgeIndex[node] != NO_PARENT)
+				{
+					tree->parentEdge[node] = edges[parentEdgeIndex[node]];
+				}
+			}
+			return tree;
+		}
+
+		template <typename T>
+		std::shared_ptr<const ShortestPathTree<T>> ShortestPathCache<T>::getTree(const Node<T> &source, ShortestPathAlgorithm algorithm)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			refresh();
+			auto sourceIndex = csr->getIndex(&source);
+			if (!sourceIndex.has_value())
+			{
+				return nullptr;
+			}
+			Key key = {&source, algorithm, version};
+			auto it = index.find(key);
+			if (it != index.end())
+			{
+				++hits;
+				lru.splice(lru.begin(), lru, it->second);
+				return it->second->second;
+			}
+			++misses;
+			// the tree is computed without holding the lock, so queries of other sources are not blocked
+			auto snapshot = csr;
+			lock.unlock();
+			std::shared_ptr<const ShortestPathTree<T>> tree = compute(snapshot, sourceIndex.value(), algorithm);
+			lock.lock();
+			if (csr != snapshot || index.count(key) > 0)
+			{
+				// the graph changed or another thread cached the same tree in the meanwhile
+				return tree;
+			}
+			auto treeSize = tree->getMemorySize();
+			if (treeSize <= byteBudget)
+			{
+				lru.emplace_front(key, tree);
+				index[key] = lru.begin();
+				memoryUsage += treeSize;
+				evict();
+			}
+			return tree;
+		}
+
+		template <typename T>
+		const DijkstraResult ShortestPathCache<T>::dijkstra(const Node<T> &source, const Node<T> &target)
+		{
+			DijkstraResult result;
+			auto tree = getTree(source, SP_DIJKSTRA);
+			if (!tree)
+			{
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			if (!tree->csr->getIndex(&target).has_value())
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			if (!tree->errorMessage.empty())
+			{
+				result.errorMessage = tree->errorMessage;
+				return result;
+			}
+			auto distance = tree->getDistance(target);
+			if (distance == INF_DOUBLE)
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+				return result;
+			}
+			result.success = true;
+			result.result = distance;
+			return result;
+		}
+
+		template <typename T>
+		const BellmanFordResult ShortestPathCache<T>::bellmanford(const Node<T> &source, const Node<T> &target)
+		{
+			BellmanFordResult result;
+			result.result = INF_DOUBLE;
+			auto tree = getTree(source, SP_BELLMAN_FORD);
+			if (!tree)
+			{
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			if (!tree->csr->getIndex(&target).has_value())
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			if (!tree->errorMessage.empty())
+			{
+				result.errorMessage = tree->errorMessage;
+				return result;
+			}
+			if (tree->negativeCycle)
+			{
+				result.success = true;
+				result.negativeCycle = true;
+				return result;
+			}
+			auto distance = tree->getDistance(target);
+			if (distance == INF_DOUBLE)
+			{
+				result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+				result.result = -1;
+				return result;
+			}
+			result.success = true;
+			result.result = distance;
+			return result;
+		}
+
+		template <typename T>
+		const DialResult ShortestPathCache<T>::dial(const Node<T> &source, int /*maxWeight*/)
+		{
+			DialResult result;
+			auto tree = getTree(source, SP_DIAL);
+			if (!tree)
+			{
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			if (!tree->errorMessage.empty())
+			{
+				result.errorMessage = tree->errorMessage;
+				return result;
+			}
+			for (std::size_t i = 0; i < tree->distances.size(); ++i)
+			{
+				result.minDistanceMap[tree->csr->getNode(i)->getId()] = tree->distances[i] == INF_DOUBLE ? std::numeric_limits<long>::max() : static_cast<long>(tree->distances[i]);
+			}
+			result.success = true;
+			return result;
+		}
+
+		template <typename T>
+		unsigned long long ShortestPathCache<T>::getHits() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return hits;
+		}
+
+		template <typename T>
+		unsigned long long ShortestPathCache<T>::getMisses() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return misses;
+		}
+
+		template <typename T>
+		unsigned long long ShortestPathCache<T>::getEvictions() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return evictions;
+		}
+
+		template <typename T>
+		std::size_t ShortestPathCache<T>::getMemoryUsage() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return memoryUsage;
+		}
+
+		template <typename T>
+		std::size_t ShortestPathCache<T>::getByteBudget() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return byteBudget;
+		}
+
+		template <typename T>
+		void ShortestPathCache<T>::setByteBudget(std::size_t byteBudget)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			this->byteBudget = byteBudget;
+			evict();
+		}
+
+		template <typename T>
+		void ShortestPathCache<T>::clear()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			lru.clear();
+			index.clear();
+			memoryUsage = 0;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_SHORTESTPATHCACHE_H__
@@ -0,0 +1,254 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_SHORTESTPATH_YENKSHORTESTPATHS_H__
+#define __CXXGRAPH_SHORTESTPATH_YENKSHORTESTPATHS_H__
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <functional>
+
+#include "Graph/CSRGraph.hpp"
+#include "ShortestPath/CSRDijkstra.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace SHORTESTPATH
+	{
+		/// A loopless path of a CSRGraph, compared by cost and then by edges
+		struct CSRPath_struct
+		{
+			double cost = 0.0;
+			std::vector<std::size_t> nodes = {}; // dense indices of the nodes, from source to target
+			std::vector<std::size_t> edges = {}; // indices in the CSRGraph of the edges, nodes.size() - 1 elements
+
+			bool operator<(const CSRPath_struct &other) const
+			{
+				return cost < other.cost || (cost == other.cost && edges < other.edges);
+			}
+		};
+		typedef CSRPath_struct CSRPath;
+
+		/// Buffers of a Dijkstra search with masked nodes and edges, reset lazily through the touched list
+		struct MaskedSearchWorkspace_struct
+		{
+			std::vector<double> dist = {};
+			std::vector<std::size_t> parentNode = {};
+			std::vector<std::size_t> parentEdge = {};
+			std::vector<std::size_t> touched = {};
+			std::vector<char> nodeMask = {};
+			std::vector<char> edgeMask = {};
+		};
+		typedef MaskedSearchWorkspace_struct MaskedSearchWorkspace;
+
+		/**
+		 * @brief Dijkstra from source to target that skips the masked nodes and edges of the workspace.
+		 * The weights must be non negative.
+		 *
+		 * @return the shortest path, if target is reachable
+		 */
+		template <typename T>
+		std::optional<CSRPath> csrMaskedDijkstra(const CSRGraph<T> &csr, std::size_t source, std::size_t target, MaskedSearchWorkspace &workspace)
+		{
+			using pq_type = std::pair<double, std::size_t>;
+			const auto &outOffset = csr.getOutOffset();
+			const auto &outTarget = csr.getOutTarget();
+			const auto &outEdge = csr.getOutEdge();
+			const auto &outWeight = csr.getOutWeight();
+			auto &dist = workspace.dist;
+			std::priority_queue<pq_type, std::vector<pq_type>, std::greater<pq_type>> pq;
+			dist[source] = 0;
+			workspace.parentNode[source] = NO_PARENT;
+			workspace.touched.push_back(source);
+			pq.push(std::make_pair(0.0, source));
+			while (!pq.empty())
+			{
+				auto [currentDist, node] = pq.top();
+				pq.pop();
+				if (currentDist > dist[node])
+				{
+					continue;
+				}
+				if (node == target)
+				{
+					break;
+				}
+				for (auto arc = outOffset[node]; arc < outOffset[node + 1]; ++arc)
+				{
+					auto next = outTarget[arc];
+					if (workspace.nodeMask[next] || workspace.edgeMask[outEdge[arc]])
+					{
+						continue;
+					}
+					if (currentDist + outWeight[arc] < dist[next])
+					{
+						if (dist[next] == INF_DOUBLE)
+						{
+							workspace.touched.push_back(next);
+						}
+						dist[next] = currentDist + outWeight[arc];
+						workspace.parentNode[next] = node;
+						workspace.parentEdge[next] = outEdge[arc];
+						pq.push(std::make_pair(dist[next], next));
+					}
+				}
+			}
+
+			std::optional<CSRPath> path;
+			if (dist[target] != INF_DOUBLE)
+			{
+				path = CSRPath();
+				for (auto node = target; node != NO_PARENT; node = workspace.parentNode[node])
+				{
+					path->nodes.push_back(node);
+					if (workspace.parentNode[node] != NO_PARENT)
+					{
+						path->edges.push_back(workspace.parentEdge[node]);
+					}
+				}
+				std::reverse(path->nodes.begin(), path->nodes.end());
+				std::reverse(path->edges.begin(), path->edges.end());
+				path->cost = dist[target];
+			}
+			for (auto node : workspace.touched)
+			{
+				dist[node] = INF_DOUBLE;
+			}
+			workspace.touched.clear();
+			return path;
+		}
+
+		/**
+		 * @brief Yen's algorithm for the k shortest loopless paths from source to target.
+		 * Every deviation of the last path found is searched on the same CSRGraph, masking the
+		 * nodes of its root path and the edges that would repeat a path already found; the
+		 * deviations are independent and are distributed between numberOfThreads threads.
+		 * The weights must be non negative. The result does not depend on numberOfThreads.
+		 *
+		 * @param csr the graph
+		 * @param source dense index of the source node
+		 * @param target dense index of the target node
+		 * @param k maximum number of paths
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @return at most k paths in order of cost, empty if target is not reachable
+		 */
+		template <typename T>
+		std::vector<CSRPath> yenKShortestPaths(const CSRGraph<T> &csr, std::size_t source, std::size_t target, std::size_t k, unsigned int numberOfThreads = 1)
+		{
+			const auto n = csr.getNumberOfNodes();
+			const auto &edgeWeight = csr.getEdgeWeight();
+			std::vector<CSRPath> paths;
+			if (k == 0)
+			{
+				return paths;
+			}
+			std::vector<MaskedSearchWorkspace> workspaces(std::max(numberOfThreads, 1u));
+			for (auto &workspace : workspaces)
+			{
+				workspace.dist.assign(n, INF_DOUBLE);
+				workspace.parentNode.assign(n, NO_PARENT);
+				workspace.parentEdge.assign(n, NO_PARENT);
+				workspace.nodeMask.assign(n, 0);
+				workspace.edgeMask.assign(csr.getNumberOfEdges(), 0);
+			}
+
+			auto first = csrMaskedDijkstra(csr, source, target, workspaces[0]);
+			if (!first.has_value())
+			{
+				return paths;
+			}
+			paths.push_back(std::move(first.value()));
+			// candidates ordered by cost, the duplicates found from different paths are merged
+			std::set<CSRPath> candidates;
+			while (paths.size() < k)
+			{
+				const auto &last = paths.back();
+				std::vector<std::optional<CSRPath>> deviations(last.edges.size());
+				parallelFor(0, last.edges.size(), numberOfThreads, 1, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+							{
+								auto &workspace = workspaces[threadId];
+								for (auto spur = begin; spur < end; ++spur)
+								{
+									// the root path is the prefix of the last path before the spur node
+									for (std::size_t i = 0; i < spur; ++i)
+									{
+										workspace.nodeMask[last.nodes[i]] = 1;
+									}
+									for (const auto &path : paths)
+									{
+										if (path.edges.size() > spur && std::equal(last.edges.begin(), last.edges.begin() + spur, path.edges.begin()))
+										{
+											workspace.edgeMask[path.edges[spur]] = 1;
+										}
+									}
+									auto spurPath = csrMaskedDijkstra(csr, last.nodes[spur], target, workspace);
+									if (spurPath.has_value())
+									{
+										CSRPath deviation;
+										deviation.nodes.assign(last.nodes.begin(), last.nodes.begin() + spur);
+										deviation.nodes.insert(deviation.nodes.end(), spurPath->nodes.begin(), spurPath->nodes.end());
+										deviation.edges.assign(last.edges.begin(), last.edges.begin() + spur);
+										deviation.edges.insert(deviation.edges.end(), spurPath->edges.begin(), spurPath->edges.end());
+										// the cost is summed in path order, so equal paths always have equal costs
+										for (auto edge : deviation.edges)
+										{
+											deviation.cost += edgeWeight[edge];
+										}
+										deviations[spur] = std::move(deviation);
+									}
+									for (std::size_t i = 0; i < spur; ++i)
+									{
+										workspace.nodeMask[last.nodes[i]] = 0;
+									}
+									for (const auto &path : paths)
+									{
+										if (path.edges.size() > spur)
+										{
+											workspace.edgeMask[path.edges[spur]] = 0;
+										}
+									}
+								}
+							});
+				for (auto &deviation : deviations)
+				{
+					if (deviation.has_value())
+					{
+						candidates.insert(std::move(deviation.value()));
+					}
+				}
+				if (candidates.empty())
+				{
+					break;
+				}
+				paths.push_back(*candidates.begin());
+				candidates.erase(candidates.begin());
+			}
+			return paths;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_SHORTESTPATH_YENKSHORTESTPATHS_H__
@@ -0,0 +1,182 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_CONCURRENTBFS_H__
+#define __CXXGRAPH_TRAVERSAL_CONCURRENTBFS_H__
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "Utility/AtomicBitmap.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Concatenate the per-thread lists at the end of out, in order of thread id.
+		 * The position of every list is the prefix sum of the sizes of the previous ones,
+		 * so the copies are done in parallel and without locks. Short lists are copied by the calling thread.
+		 */
+		inline void concatenateLocalLists(std::vector<std::vector<std::size_t>> &local, std::vector<std::size_t> &out, unsigned int numberOfThreads)
+		{
+			std::vector<std::size_t> position(local.size() + 1, out.size());
+			for (std::size_t t = 0; t < local.size(); ++t)
+			{
+				position[t + 1] = position[t] + local[t].size();
+			}
+			const auto threads = position.back() - out.size() < BFS_BOTTOM_UP_GRAIN ? 1u : numberOfThreads;
+			out.resize(position.back());
+			parallelFor(0, local.size(), threads, 1, [&](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto t = begin; t < end; ++t)
+							{
+								std::copy(local[t].begin(), local[t].end(), out.begin() + position[t]);
+								local[t].clear();
+							} });
+		}
+
+		/**
+		 * @brief Level synchronous parallel breadth first search from a set of sources over an adjacency in CSR format.
+		 * The visited set is an AtomicBitmap, a node is claimed by the thread whose fetch_or sets its bit.
+		 * The frontier is sparse, a range of the visit order, and the next one is built in one of two ways:
+		 * - sparse: every thread appends the nodes it claims to a local list, and the lists are
+		 *   concatenated with prefix sums;
+		 * - dense: when the arcs leaving the frontier are more than 1 / BFS_DENSE_FRONTIER_DIVISOR of
+		 *   the nodes, the threads only set the bits, and the new nodes are extracted from the words of
+		 *   the bitmap that changed during the level, in order of index.
+		 * No lock is taken and the threads share only the bitmap.
+		 *
+		 * All the sources form the first level, so the search reaches the nodes reachable from any of them.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param sources dense indices of the source nodes
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param order output reached nodes, level by level
+		 */
+		inline void csrConcurrentMultiSourceBFS(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, const std::vector<std::size_t> &sources, unsigned int numberOfThreads, std::vector<std::size_t> &order)
+		{
+			const auto n = offset.size() - 1;
+			const auto threads = std::max(numberOfThreads, 1u);
+			AtomicBitmap visited(n);
+			std::vector<uint64_t> previousWords;
+			std::vector<std::vector<std::size_t>> localList(threads);
+			std::vector<std::size_t> localArcs(threads);
+			order.clear();
+			std::size_t levelBegin = 0;
+			std::size_t frontierArcs = 0;
+			for (auto source : sources)
+			{
+				if (visited.testAndSet(source))
+				{
+					order.push_back(source);
+					frontierArcs += offset[source + 1] - offset[source];
+				}
+			}
+
+			while (levelBegin < order.size())
+			{
+				const auto levelEnd = order.size();
+				const bool dense = frontierArcs > n / BFS_DENSE_FRONTIER_DIVISOR;
+				if (dense)
+				{
+					previousWords.resize(visited.getNumberOfWords());
+					for (std::size_t word = 0; word < previousWords.size(); ++word)
+					{
+						previousWords[word] = visited.getWord(word);
+					}
+				}
+				std::fill(localArcs.begin(), localArcs.end(), 0);
+				parallelFor(levelBegin, levelEnd, threads, BFS_TOP_DOWN_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+							{
+								auto &local = localList[threadId];
+								std::size_t arcs = 0;
+								for (auto i = begin; i < end; ++i)
+								{
+									auto u = order[i];
+									for (auto arc = offset[u]; arc < offset[u + 1]; ++arc)
+									{
+										auto v = adjacency[arc];
+										if (visited.testAndSet(v))
+										{
+											arcs += offset[v + 1] - offset[v];
+											if (!dense)
+											{
+												local.push_back(v);
+											}
+										}
+									}
+								}
+								localArcs[threadId] += arcs; });
+
+				if (dense)
+				{
+					// every thread extracts the new bits of a block of words
+					const auto numberOfWords = previousWords.size();
+					parallelFor(0, threads, threads, 1, [&](std::size_t begin, std::size_t end, unsigned int)
+								{
+									for (auto block = begin; block < end; ++block)
+									{
+										auto &local = localList[block];
+										for (auto word = block * numberOfWords / threads; word < (block + 1) * numberOfWords / threads; ++word)
+										{
+											auto bits = visited.getWord(word) & ~previousWords[word];
+											for (std::size_t bit = 0; bits; ++bit, bits >>= 1)
+											{
+												if (bits & 1)
+												{
+													local.push_back(word * 64 + bit);
+												}
+											}
+										}
+									} });
+				}
+				concatenateLocalLists(localList, order, threads);
+				frontierArcs = 0;
+				for (auto arcs : localArcs)
+				{
+					frontierArcs += arcs;
+				}
+				levelBegin = levelEnd;
+			}
+		}
+
+		/**
+		 * @brief Level synchronous parallel breadth first search from a single source, see csrConcurrentMultiSourceBFS
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param source dense index of the source node
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param order output reached nodes, level by level
+		 */
+		inline void csrConcurrentBFS(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, std::size_t source, unsigned int numberOfThreads, std::vector<std::size_t> &order)
+		{
+			csrConcurrentMultiSourceBFS(offset, adjacency, std::vector<std::size_t>(1, source), numberOfThreads, order);
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_CONCURRENTBFS_H__
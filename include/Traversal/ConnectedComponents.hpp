@@ -0,0 +1,196 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_CONNECTEDCOMPONENTS_H__
+#define __CXXGRAPH_TRAVERSAL_CONNECTEDCOMPONENTS_H__
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <random>
+#include <unordered_map>
+#include <algorithm>
+
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Lock-free union of the trees of u and v in a forest of parent pointers: the root with the
+		 * higher index is hooked below the lower one with a compare and swap, that fails and is
+		 * retried if another thread changed the root in the meantime. The trees are not compressed.
+		 */
+		inline void concurrentLink(std::size_t u, std::size_t v, std::vector<std::atomic<std::size_t>> &parent)
+		{
+			auto p1 = parent[u].load(std::memory_order_relaxed);
+			auto p2 = parent[v].load(std::memory_order_relaxed);
+			while (p1 != p2)
+			{
+				auto high = std::max(p1, p2);
+				auto low = std::min(p1, p2);
+				auto highParent = parent[high].load(std::memory_order_relaxed);
+				if (highParent == low)
+				{
+					break;
+				}
+				if (highParent == high && parent[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed))
+				{
+					break;
+				}
+				p1 = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+				p2 = parent[low].load(std::memory_order_relaxed);
+			}
+		}
+
+		/// Point every node of [0, n) directly to the root of its tree
+		inline void concurrentCompress(std::vector<std::atomic<std::size_t>> &parent, unsigned int numberOfThreads)
+		{
+			parallelFor(0, parent.size(), numberOfThreads, AFFOREST_GRAIN, [&parent](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								auto p = parent[node].load(std::memory_order_relaxed);
+								while (p != parent[p].load(std::memory_order_relaxed))
+								{
+									p = parent[p].load(std::memory_order_relaxed);
+								}
+								parent[node].store(p, std::memory_order_relaxed);
+							} });
+		}
+
+		/**
+		 * @brief Parallel connected components with the Afforest algorithm (Sutton et al.) over a graph in CSR format.
+		 * The components are a concurrent union-find: the first AFFOREST_NEIGHBOR_ROUNDS arcs of every node
+		 * are linked, then the largest component is estimated from AFFOREST_SAMPLES nodes and the
+		 * remaining arcs are linked only for the nodes outside of it, that skips most of the arcs of
+		 * graphs with a giant component.
+		 * If the adjacency is not symmetric (a directed graph) the transpose is needed: the nodes outside
+		 * of the largest component also link their incoming arcs, and the result are the weakly connected components.
+		 * The ids of the components are in order of their node with the smallest index, independently of the threads.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param inOffset start of the incoming arcs of every node, nullptr if the adjacency is symmetric
+		 * @param inAdjacency tail of every incoming arc, nullptr if the adjacency is symmetric
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param componentId output component of every node
+		 * @return the number of components
+		 */
+		inline std::size_t csrAfforest(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, const std::vector<std::size_t> *inOffset, const std::vector<std::size_t> *inAdjacency, unsigned int numberOfThreads, std::vector<std::size_t> &componentId)
+		{
+			const auto n = offset.size() - 1;
+			const auto threads = std::max(numberOfThreads, 1u);
+			componentId.clear();
+			if (n == 0)
+			{
+				return 0;
+			}
+			std::vector<std::atomic<std::size_t>> parent(n);
+			parallelFor(0, n, threads, AFFOREST_GRAIN, [&parent](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								parent[node].store(node, std::memory_order_relaxed);
+							} });
+
+			// neighbour sampling
+			for (std::size_t round = 0; round < AFFOREST_NEIGHBOR_ROUNDS; ++round)
+			{
+				parallelFor(0, n, threads, AFFOREST_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+							{
+								for (auto node = begin; node < end; ++node)
+								{
+									if (offset[node] + round < offset[node + 1])
+									{
+										concurrentLink(node, adjacency[offset[node] + round], parent);
+									}
+								} });
+				concurrentCompress(parent, threads);
+			}
+
+			// the most frequent root among the sampled nodes
+			std::mt19937 generator(static_cast<unsigned int>(n));
+			std::uniform_int_distribution<std::size_t> nodeDistribution(0, n - 1);
+			std::unordered_map<std::size_t, std::size_t> frequency;
+			std::size_t largest = 0;
+			std::size_t largestFrequency = 0;
+			for (std::size_t sample = 0; sample < AFFOREST_SAMPLES; ++sample)
+			{
+				auto root = parent[nodeDistribution(generator)].load(std::memory_order_relaxed);
+				if (++frequency[root] > largestFrequency)
+				{
+					largest = root;
+					largestFrequency = frequency[root];
+				}
+			}
+
+			// the arcs of the nodes outside of the largest component, an arc from a node inside
+			// it is linked by its head through the incoming arcs if the adjacency is not symmetric
+			parallelFor(0, n, threads, AFFOREST_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								if (parent[node].load(std::memory_order_relaxed) == largest)
+								{
+									continue;
+								}
+								for (auto arc = offset[node] + AFFOREST_NEIGHBOR_ROUNDS; arc < offset[node + 1]; ++arc)
+								{
+									concurrentLink(node, adjacency[arc], parent);
+								}
+								if (inOffset != nullptr)
+								{
+									for (auto arc = (*inOffset)[node]; arc < (*inOffset)[node + 1]; ++arc)
+									{
+										concurrentLink(node, (*inAdjacency)[arc], parent);
+									}
+								}
+							} });
+			concurrentCompress(parent, threads);
+
+			// the roots are the smallest node of their component, numbered in order of index
+			componentId.resize(n);
+			std::size_t numberOfComponents = 0;
+			for (std::size_t node = 0; node < n; ++node)
+			{
+				if (parent[node].load(std::memory_order_relaxed) == node)
+				{
+					componentId[node] = numberOfComponents++;
+				}
+			}
+			parallelFor(0, n, threads, AFFOREST_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								auto root = parent[node].load(std::memory_order_relaxed);
+								if (root != node)
+								{
+									componentId[node] = componentId[root];
+								}
+							} });
+			return numberOfComponents;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_CONNECTEDCOMPONENTS_H__
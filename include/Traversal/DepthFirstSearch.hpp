@@ -0,0 +1,117 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_DEPTHFIRSTSEARCH_H__
+#define __CXXGRAPH_TRAVERSAL_DEPTHFIRSTSEARCH_H__
+
+#pragma once
+
+#include <vector>
+#include <utility>
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/// Depth first search over an adjacency in CSR format, with an explicit stack instead of the
+		/// recursion, so the depth of the search is not limited by the stack of the thread.
+		/// The visited set is a bitset shared by the searches started with run(), until reset().
+		/// The neighbours are visited in the order of the adjacency, as a recursive search would do.
+		class DepthFirstSearch
+		{
+		private:
+			const std::vector<std::size_t> &offset;
+			const std::vector<std::size_t> &adjacency;
+			std::vector<bool> visited = {};
+			std::vector<std::pair<std::size_t, std::size_t>> stack = {}; // node and its next arc
+
+		public:
+			/**
+			 * @param offset start of the adjacency range of every node (size n + 1)
+			 * @param adjacency head of every arc
+			 */
+			DepthFirstSearch(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency)
+				: offset(offset), adjacency(adjacency), visited(offset.size() - 1, false) {}
+			~DepthFirstSearch() = default;
+
+			bool isVisited(std::size_t node) const
+			{
+				return visited[node];
+			}
+			/// Forget the nodes visited by the previous searches
+			void reset()
+			{
+				visited.assign(visited.size(), false);
+			}
+			/**
+			 * @brief Visit the nodes reachable from root that were not visited yet.
+			 * If root was already visited nothing is done.
+			 *
+			 * @param root dense index of the first node
+			 * @param preOrder called with every node when it is reached
+			 * @param postOrder called with every node when all its neighbours have been visited
+			 * @param nonTreeArc called with the tail and the head of every arc that reaches a node already visited
+			 */
+			template <typename PreOrder, typename PostOrder, typename NonTreeArc>
+			void run(std::size_t root, PreOrder &&preOrder, PostOrder &&postOrder, NonTreeArc &&nonTreeArc)
+			{
+				if (visited[root])
+				{
+					return;
+				}
+				visited[root] = true;
+				preOrder(root);
+				stack.emplace_back(root, offset[root]);
+				while (!stack.empty())
+				{
+					auto &[node, arc] = stack.back();
+					if (arc == offset[node + 1])
+					{
+						auto finished = node;
+						stack.pop_back();
+						postOrder(finished);
+						continue;
+					}
+					auto next = adjacency[arc++];
+					if (visited[next])
+					{
+						nonTreeArc(node, next);
+						continue;
+					}
+					visited[next] = true;
+					preOrder(next);
+					// node and arc are not used after the push, that can move the stack
+					stack.emplace_back(next, offset[next]);
+				}
+			}
+			template <typename PreOrder, typename PostOrder>
+			void run(std::size_t root, PreOrder &&preOrder, PostOrder &&postOrder)
+			{
+				run(root, preOrder, postOrder, [](std::size_t, std::size_t) {});
+			}
+			template <typename PreOrder>
+			void run(std::size_t root, PreOrder &&preOrder)
+			{
+				run(root, preOrder, [](std::size_t) {}, [](std::size_t, std::size_t) {});
+			}
+		};
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_DEPTHFIRSTSEARCH_H__
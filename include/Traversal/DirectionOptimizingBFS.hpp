@@ -0,0 +1,194 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_DIRECTIONOPTIMIZINGBFS_H__
+#define __CXXGRAPH_TRAVERSAL_DIRECTIONOPTIMIZINGBFS_H__
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		constexpr std::size_t NOT_VISITED = std::numeric_limits<std::size_t>::max();
+
+		/**
+		 * @brief Direction-optimizing breadth first search over a graph in CSR format (Beamer et al.).
+		 * The levels are expanded top-down from the frontier while it is small; when the arcs leaving
+		 * the frontier are more than 1 / BFS_ALPHA of the arcs leaving the unvisited nodes, every
+		 * unvisited node looks for a parent in the frontier through its incoming arcs (bottom-up),
+		 * and stops at the first one, until the frontier shrinks below 1 / BFS_BETA of the nodes.
+		 * Every level is split between numberOfThreads threads: top-down the nodes are claimed with a
+		 * compare and swap on their depth, bottom-up every thread owns the nodes of its chunks.
+		 * The depths do not depend on the number of threads, with more than one thread the parent of
+		 * a node is any of its neighbours in the previous level.
+		 *
+		 * @param outOffset start of the outgoing arcs of every node (size n + 1)
+		 * @param outTarget head of every outgoing arc
+		 * @param inOffset start of the incoming arcs of every node (size n + 1)
+		 * @param inSource tail of every incoming arc
+		 * @param source dense index of the source node
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param depth output depth of every node, NOT_VISITED for the nodes not reachable
+		 * @param parent output parent of every node, NOT_VISITED for the source and the nodes not reachable
+		 */
+		inline void csrDirectionOptimizingBFS(const std::vector<std::size_t> &outOffset, const std::vector<std::size_t> &outTarget, const std::vector<std::size_t> &inOffset, const std::vector<std::size_t> &inSource, std::size_t source, unsigned int numberOfThreads, std::vector<std::size_t> &depth, std::vector<std::size_t> &parent)
+		{
+			const auto n = outOffset.size() - 1;
+			const auto threads = std::max(numberOfThreads, 1u);
+			std::vector<std::atomic<std::size_t>> level(n);
+			parallelFor(0, n, threads, BFS_BOTTOM_UP_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto v = begin; v < end; ++v)
+							{
+								level[v].store(NOT_VISITED, std::memory_order_relaxed);
+							}
+						});
+			parent.assign(n, NOT_VISITED);
+
+			// the frontier is a queue of nodes top-down and a bitmap bottom-up
+			std::vector<std::size_t> queue = {source};
+			std::vector<char> frontier, next;
+			std::vector<std::vector<std::size_t>> localQueue(threads);
+			std::vector<std::size_t> localCount(threads);
+			level[source].store(0, std::memory_order_relaxed);
+			std::size_t frontierSize = 1;
+			std::size_t previousFrontierSize = 0;
+			std::size_t frontierArcs = outOffset[source + 1] - outOffset[source];
+			std::size_t unvisitedArcs = outOffset[n] - frontierArcs;
+			bool topDown = true;
+
+			for (std::size_t currentDepth = 0; frontierSize > 0; ++currentDepth)
+			{
+				if (topDown && frontierArcs > unvisitedArcs / BFS_ALPHA)
+				{
+					// queue to bitmap
+					topDown = false;
+					frontier.assign(n, 0);
+					next.assign(n, 0);
+					for (auto u : queue)
+					{
+						frontier[u] = 1;
+					}
+				}
+				else if (!topDown && frontierSize < n / BFS_BETA && frontierSize < previousFrontierSize)
+				{
+					// bitmap to queue
+					topDown = true;
+					queue.clear();
+					for (std::size_t v = 0; v < n; ++v)
+					{
+						if (frontier[v])
+						{
+							queue.push_back(v);
+						}
+					}
+				}
+
+				const auto nextDepth = currentDepth + 1;
+				previousFrontierSize = frontierSize;
+				std::fill(localCount.begin(), localCount.end(), 0);
+				if (topDown)
+				{
+					parallelFor(0, queue.size(), threads, BFS_TOP_DOWN_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+								{
+									auto &local = localQueue[threadId];
+									for (auto i = begin; i < end; ++i)
+									{
+										auto u = queue[i];
+										for (auto arc = outOffset[u]; arc < outOffset[u + 1]; ++arc)
+										{
+											auto v = outTarget[arc];
+											auto expected = NOT_VISITED;
+											if (level[v].load(std::memory_order_relaxed) == NOT_VISITED &&
+												level[v].compare_exchange_strong(expected, nextDepth, std::memory_order_relaxed))
+											{
+												parent[v] = u;
+												local.push_back(v);
+												localCount[threadId] += outOffset[v + 1] - outOffset[v];
+											}
+										}
+									} });
+					queue.clear();
+					for (auto &local : localQueue)
+					{
+						queue.insert(queue.end(), local.begin(), local.end());
+						local.clear();
+					}
+					frontierSize = queue.size();
+				}
+				else
+				{
+					std::vector<std::size_t> localSize(threads, 0);
+					parallelFor(0, n, threads, BFS_BOTTOM_UP_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+								{
+									for (auto v = begin; v < end; ++v)
+									{
+										next[v] = 0;
+										if (level[v].load(std::memory_order_relaxed) != NOT_VISITED)
+										{
+											continue;
+										}
+										for (auto arc = inOffset[v]; arc < inOffset[v + 1]; ++arc)
+										{
+											auto u = inSource[arc];
+											if (frontier[u])
+											{
+												level[v].store(nextDepth, std::memory_order_relaxed);
+												parent[v] = u;
+												next[v] = 1;
+												localSize[threadId]++;
+												localCount[threadId] += outOffset[v + 1] - outOffset[v];
+												break;
+											}
+										}
+									} });
+					frontier.swap(next);
+					frontierSize = 0;
+					for (auto size : localSize)
+					{
+						frontierSize += size;
+					}
+				}
+				frontierArcs = 0;
+				for (auto count : localCount)
+				{
+					frontierArcs += count;
+				}
+				unvisitedArcs -= frontierArcs;
+			}
+
+			depth.resize(n);
+			for (std::size_t v = 0; v < n; ++v)
+			{
+				depth[v] = level[v].load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_DIRECTIONOPTIMIZINGBFS_H__
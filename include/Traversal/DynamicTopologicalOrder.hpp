@@ -0,0 +1,490 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_DYNAMICTOPOLOGICALORDER_H__
+#define __CXXGRAPH_TRAVERSAL_DYNAMICTOPOLOGICALORDER_H__
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+
+#include "Graph/Graph.hpp"
+#include "Graph/GraphObserver.hpp"
+#include "Graph/CSRGraph.hpp"
+#include "Traversal/ParallelKahn.hpp"
+#include "Utility/ConstString.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/// Class that maintain a topological order of a directed Graph while edges are added, with the
+		/// algorithm of Pearce and Kelly. The order is attached to the Graph as an observer: an edge
+		/// that goes forward in the order changes nothing, an edge x -> y that goes backward is repaired
+		/// by a forward search from y and a backward search from x limited to the nodes between them,
+		/// and only the nodes found are moved, into the positions they already occupied. The forward
+		/// search reaching x means that the edge closes a cycle.
+		/// addEdge rejects the edges that would close a cycle; an edge that closes a cycle and is added
+		/// directly to the Graph is kept aside (the order is the one of the Graph without it) and the
+		/// Graph is reported as cyclic, until a removal lets it be inserted again.
+		/// An undirected edge is a cycle of two nodes. Removing edges never invalidates the order, the
+		/// nodes left without edges are dropped from it.
+		/// The Graph should outlive the order: if it is destroyed first the order keeps its last state
+		/// and addEdge rejects every edge.
+		/// ( This class is not Thread Safe )
+		template <typename T>
+		class DynamicTopologicalOrder : public GraphObserver<T>
+		{
+		private:
+			// null after the Graph is destroyed
+			Graph<T> *graph = nullptr;
+
+			std::vector<const Node<T> *> nodes = {};
+			std::unordered_map<const Node<T> *, std::size_t> nodeIndex = {};
+			std::vector<std::vector<std::size_t>> outArcs = {};
+			std::vector<std::vector<std::size_t>> inArcs = {};
+			std::vector<std::size_t> position = {}; // position of every node in the order
+			std::vector<std::size_t> order = {};	// node at every position
+			std::vector<char> present = {};			// false for the nodes that left the Graph, they keep their index
+			std::unordered_set<const Edge<T> *> edges = {};
+			std::unordered_set<const Edge<T> *> cycleEdges = {};
+			const Edge<T> *pendingEdge = nullptr;
+
+			// search of the last update in which every node was visited
+			std::vector<unsigned long long> visitedIn = {};
+			unsigned long long numberOfSearches = 0;
+			std::vector<std::size_t> stack = {};
+			std::vector<std::size_t> forward = {};
+			std::vector<std::size_t> backward = {};
+
+			unsigned long long numberOfUpdates = 0;
+			std::size_t lastVisitedNodes = 0;
+			unsigned long long totalVisitedNodes = 0;
+			unsigned long long totalMovedNodes = 0;
+
+			std::size_t addNode(const Node<T> *node);
+			void dropIfIsolated(const Node<T> *node);
+			bool search(std::size_t start, const std::vector<std::vector<std::size_t>> &arcs, bool isForward, std::size_t bound, std::vector<std::size_t> &found);
+			bool insert(const Edge<T> *edge);
+			void beginUpdate();
+			void rebuild();
+
+		public:
+			DynamicTopologicalOrder(Graph<T> &graph);
+			DynamicTopologicalOrder(const DynamicTopologicalOrder<T> &) = delete;
+			DynamicTopologicalOrder<T> &operator=(const DynamicTopologicalOrder<T> &) = delete;
+			~DynamicTopologicalOrder();
+
+			/**
+			 * @brief Add the edge to the Graph if it does not close a cycle
+			 *
+			 * @return true if the edge was added (or was already in the Graph without closing a cycle),
+			 * false if it closes a cycle or the Graph was destroyed, in that case the Graph is not modified
+			 */
+			bool addEdge(const Edge<T> *edge);
+			/**
+			 * @brief Return true if no edge of the Graph closes a cycle
+			 */
+			bool isAcyclic() const;
+			/**
+			 * @brief Return the error that makes the order not valid for the whole Graph, empty if it is acyclic
+			 */
+			std::string getErrorMessage() const;
+			/**
+			 * @brief Return the nodes of the Graph in topological order
+			 */
+			std::vector<const Node<T> *> getOrder() const;
+			/**
+			 * @brief Return true if both nodes are in the Graph and a comes before b in the order
+			 */
+			bool isBefore(const Node<T> &a, const Node<T> &b) const;
+			/**
+			 * @brief Return the number of modifications of the Graph and of the edges rejected by addEdge
+			 */
+			unsigned long long getNumberOfUpdates() const;
+			/**
+			 * @brief Return the number of nodes visited by the searches of the last update
+			 */
+			std::size_t getLastVisitedNodes() const;
+			/**
+			 * @brief Return the number of nodes visited by the searches of all the updates
+			 */
+			unsigned long long getTotalVisitedNodes() const;
+			/**
+			 * @brief Return the number of nodes moved in the order by all the updates
+			 */
+			unsigned long long getTotalMovedNodes() const;
+			/**
+			 * @brief Return the average number of nodes visited by an update
+			 */
+			double getAmortizedVisitedNodes() const;
+
+			void onEdgeAdded(const Edge<T> *edge) override;
+			void onEdgeRemoved(const Edge<T> *edge) override;
+			void onEdgeWeightChanged(const Edge<T> *edge, double oldWeight) override;
+			void onEdgeSetChanged() override;
+			void onGraphDestroyed() override;
+		};
+
+		template <typename T>
+		DynamicTopologicalOrder<T>::DynamicTopologicalOrder(Graph<T> &graph) : graph(&graph)
+		{
+			graph.attachObserver(this);
+			// the first build is not an update
+			rebuild();
+			lastVisitedNodes = 0;
+			totalVisitedNodes = 0;
+			totalMovedNodes = 0;
+		}
+
+		template <typename T>
+		DynamicTopologicalOrder<T>::~DynamicTopologicalOrder()
+		{
+			if (graph)
+			{
+				graph->detachObserver(this);
+			}
+		}
+
+		template <typename T>
+		std::size_t DynamicTopologicalOrder<T>::addNode(const Node<T> *node)
+		{
+			auto it = nodeIndex.find(node);
+			if (it != nodeIndex.end())
+			{
+				// a node that comes back has no edges, so its old position is still valid
+				present[it->second] = 1;
+				return it->second;
+			}
+			// a new node has no edges yet, so it can go at the end of the order
+			nodeIndex[node] = nodes.size();
+			position.push_back(nodes.size());
+			order.push_back(nodes.size());
+			present.push_back(1);
+			nodes.push_back(node);
+			outArcs.emplace_back();
+			inArcs.emplace_back();
+			visitedIn.push_back(0);
+			return nodes.size() - 1;
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::dropIfIsolated(const Node<T> *node)
+		{
+			auto index = nodeIndex.at(node);
+			if (!outArcs[index].empty() || !inArcs[index].empty())
+			{
+				return;
+			}
+			for (auto cycleEdge : cycleEdges)
+			{
+				if (cycleEdge->getNodePair().first == node || cycleEdge->getNodePair().second == node)
+				{
+					return;
+				}
+			}
+			present[index] = 0;
+		}
+
+		template <typename T>
+		bool DynamicTopologicalOrder<T>::search(std::size_t start, const std::vector<std::vector<std::size_t>> &arcs, bool isForward, std::size_t bound, std::vector<std::size_t> &found)
+		{
+			found.clear();
+			visitedIn[start] = numberOfSearches;
+			stack.assign(1, start);
+			while (!stack.empty())
+			{
+				auto node = stack.back();
+				stack.pop_back();
+				found.push_back(node);
+				++lastVisitedNodes;
+				++totalVisitedNodes;
+				for (auto next : arcs[node])
+				{
+					if (isForward && position[next] == bound)
+					{
+						// the tail of the new edge is reached from its head
+						return false;
+					}
+					// only the nodes between the head and the tail of the new edge can be misplaced
+					auto inRange = isForward ? position[next] < bound : position[next] > bound;
+					if (inRange && visitedIn[next] != numberOfSearches)
+					{
+						visitedIn[next] = numberOfSearches;
+						stack.push_back(next);
+					}
+				}
+			}
+			return true;
+		}
+
+		template <typename T>
+		bool DynamicTopologicalOrder<T>::insert(const Edge<T> *edge)
+		{
+			// the edges rejected without a search do not add their nodes
+			if (edge->getNodePair().first == edge->getNodePair().second || (edge->isDirected().has_value() && !edge->isDirected().value()))
+			{
+				return false;
+			}
+			auto from = addNode(edge->getNodePair().first);
+			auto to = addNode(edge->getNodePair().second);
+			if (position[from] > position[to])
+			{
+				++numberOfSearches;
+				if (!search(to, outArcs, true, position[from], forward))
+				{
+					return false;
+				}
+				search(from, inArcs, false, position[to], backward);
+
+				// the nodes that reach the tail go before the ones reached from the head, in the same positions
+				auto byPosition = [this](std::size_t a, std::size_t b)
+				{ return position[a] < position[b]; };
+				std::sort(backward.begin(), backward.end(), byPosition);
+				std::sort(forward.begin(), forward.end(), byPosition);
+				std::vector<std::size_t> moved(backward);
+				moved.insert(moved.end(), forward.begin(), forward.end());
+				std::vector<std::size_t> positions;
+				positions.reserve(moved.size());
+				for (auto node : moved)
+				{
+					positions.push_back(position[node]);
+				}
+				std::sort(positions.begin(), positions.end());
+				for (std::size_t i = 0; i < moved.size(); ++i)
+				{
+					position[moved[i]] = positions[i];
+					order[positions[i]] = moved[i];
+				}
+				totalMovedNodes += moved.size();
+			}
+			outArcs[from].push_back(to);
+			inArcs[to].push_back(from);
+			edges.insert(edge);
+			return true;
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::beginUpdate()
+		{
+			++numberOfUpdates;
+			lastVisitedNodes = 0;
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::rebuild()
+		{
+			nodes.clear();
+			nodeIndex.clear();
+			outArcs.clear();
+			inArcs.clear();
+			position.clear();
+			order.clear();
+			present.clear();
+			edges.clear();
+			cycleEdges.clear();
+			visitedIn.clear();
+			numberOfSearches = 0;
+
+			const auto edgeSet = graph->getEdgeSet();
+			const CSRGraph<T> csr(edgeSet);
+			for (auto node : csr.getNodes())
+			{
+				addNode(node);
+			}
+			// start from the order of kahn's algorithm, if the Graph is cyclic the edges
+			// are inserted one by one and the ones that close a cycle are kept aside
+			std::vector<std::size_t> kahnOrder;
+			std::vector<std::size_t> level;
+			if (csrParallelKahn(csr.getOutOffset(), csr.getOutTarget(), csr.getInOffset(), 1, kahnOrder, level))
+			{
+				order = kahnOrder;
+				for (std::size_t i = 0; i < order.size(); ++i)
+				{
+					position[order[i]] = i;
+				}
+			}
+			for (const auto &edge : edgeSet)
+			{
+				if (!insert(edge))
+				{
+					edges.insert(edge);
+					cycleEdges.insert(edge);
+				}
+			}
+		}
+
+		template <typename T>
+		bool DynamicTopologicalOrder<T>::addEdge(const Edge<T> *edge)
+		{
+			if (!graph)
+			{
+				return false;
+			}
+			if (edges.count(edge))
+			{
+				return !cycleEdges.count(edge);
+			}
+			beginUpdate();
+			if (!insert(edge))
+			{
+				return false;
+			}
+			// the order is already repaired, the notification of the Graph is skipped
+			pendingEdge = edge;
+			graph->addEdge(edge);
+			pendingEdge = nullptr;
+			return true;
+		}
+
+		template <typename T>
+		bool DynamicTopologicalOrder<T>::isAcyclic() const
+		{
+			return cycleEdges.empty();
+		}
+
+		template <typename T>
+		std::string DynamicTopologicalOrder<T>::getErrorMessage() const
+		{
+			return isAcyclic() ? "" : ERR_CYCLIC_GRAPH;
+		}
+
+		template <typename T>
+		std::vector<const Node<T> *> DynamicTopologicalOrder<T>::getOrder() const
+		{
+			std::vector<const Node<T> *> result;
+			result.reserve(order.size());
+			for (auto node : order)
+			{
+				if (present[node])
+				{
+					result.push_back(nodes[node]);
+				}
+			}
+			return result;
+		}
+
+		template <typename T>
+		bool DynamicTopologicalOrder<T>::isBefore(const Node<T> &a, const Node<T> &b) const
+		{
+			auto itA = nodeIndex.find(&a);
+			auto itB = nodeIndex.find(&b);
+			return itA != nodeIndex.end() && itB != nodeIndex.end() && present[itA->second] && present[itB->second] &&
+				   position[itA->second] < position[itB->second];
+		}
+
+		template <typename T>
+		unsigned long long DynamicTopologicalOrder<T>::getNumberOfUpdates() const
+		{
+			return numberOfUpdates;
+		}
+
+		template <typename T>
+		std::size_t DynamicTopologicalOrder<T>::getLastVisitedNodes() const
+		{
+			return lastVisitedNodes;
+		}
+
+		template <typename T>
+		unsigned long long DynamicTopologicalOrder<T>::getTotalVisitedNodes() const
+		{
+			return totalVisitedNodes;
+		}
+
+		template <typename T>
+		unsigned long long DynamicTopologicalOrder<T>::getTotalMovedNodes() const
+		{
+			return totalMovedNodes;
+		}
+
+		template <typename T>
+		double DynamicTopologicalOrder<T>::getAmortizedVisitedNodes() const
+		{
+			return numberOfUpdates == 0 ? 0.0 : static_cast<double>(totalVisitedNodes) / numberOfUpdates;
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::onEdgeAdded(const Edge<T> *edge)
+		{
+			if (edge == pendingEdge)
+			{
+				return;
+			}
+			beginUpdate();
+			if (!insert(edge))
+			{
+				// the edge is in the Graph, so its nodes are too
+				addNode(edge->getNodePair().first);
+				addNode(edge->getNodePair().second);
+				edges.insert(edge);
+				cycleEdges.insert(edge);
+			}
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::onEdgeRemoved(const Edge<T> *edge)
+		{
+			beginUpdate();
+			edges.erase(edge);
+			if (!cycleEdges.erase(edge))
+			{
+				auto from = nodeIndex.at(edge->getNodePair().first);
+				auto to = nodeIndex.at(edge->getNodePair().second);
+				outArcs[from].erase(std::find(outArcs[from].begin(), outArcs[from].end(), to));
+				inArcs[to].erase(std::find(inArcs[to].begin(), inArcs[to].end(), from));
+				// the edges kept aside may not close a cycle anymore
+				std::vector<const Edge<T> *> retry(cycleEdges.begin(), cycleEdges.end());
+				for (auto cycleEdge : retry)
+				{
+					if (insert(cycleEdge))
+					{
+						cycleEdges.erase(cycleEdge);
+					}
+				}
+			}
+			dropIfIsolated(edge->getNodePair().first);
+			dropIfIsolated(edge->getNodePair().second);
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::onEdgeWeightChanged(const Edge<T> *, double)
+		{
+			// the order does not depend on the weights
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::onEdgeSetChanged()
+		{
+			beginUpdate();
+			rebuild();
+		}
+
+		template <typename T>
+		void DynamicTopologicalOrder<T>::onGraphDestroyed()
+		{
+			graph = nullptr;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_DYNAMICTOPOLOGICALORDER_H__
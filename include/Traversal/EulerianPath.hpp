@@ -0,0 +1,154 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_EULERIANPATH_H__
+#define __CXXGRAPH_TRAVERSAL_EULERIANPATH_H__
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <optional>
+#include <algorithm>
+
+#include "Traversal/DirectionOptimizingBFS.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Check the degree conditions of an eulerian path and return its start node.
+		 * - directed: every node has as many outgoing as incoming arcs (circuit), or one node has one
+		 *   more outgoing arc (the start) and one node has one more incoming arc (the end);
+		 * - undirected: every undirected edge is an arc in both directions, so the degree is the number
+		 *   of outgoing arcs; no node has odd degree (circuit), or two nodes have, one is the start.
+		 * The connectivity is not checked: the path found from the start must use all the edges.
+		 *
+		 * @param outOffset start of the outgoing arcs of every node (size n + 1)
+		 * @param inOffset start of the incoming arcs of every node (size n + 1)
+		 * @param directed true if every edge is directed, false if every edge is undirected
+		 * @param circuit output true if the path must end in its start node
+		 * @return the start node, nothing if the degrees do not allow an eulerian path
+		 */
+		inline std::optional<std::size_t> csrEulerianStart(const std::vector<std::size_t> &outOffset, const std::vector<std::size_t> &inOffset, bool directed, bool &circuit)
+		{
+			const auto n = outOffset.size() - 1;
+			std::optional<std::size_t> start;
+			std::size_t unbalanced = 0;
+			for (std::size_t node = 0; node < n; ++node)
+			{
+				auto outDegree = outOffset[node + 1] - outOffset[node];
+				auto inDegree = inOffset[node + 1] - inOffset[node];
+				if (directed)
+				{
+					if (outDegree == inDegree)
+					{
+						continue;
+					}
+					if (outDegree > inDegree + 1 || inDegree > outDegree + 1)
+					{
+						return std::nullopt;
+					}
+					if (outDegree > inDegree)
+					{
+						if (start.has_value())
+						{
+							return std::nullopt;
+						}
+						start = node;
+					}
+					++unbalanced;
+				}
+				else if (outDegree % 2 == 1)
+				{
+					if (!start.has_value())
+					{
+						start = node;
+					}
+					++unbalanced;
+				}
+			}
+			if (unbalanced != 0 && unbalanced != 2)
+			{
+				return std::nullopt;
+			}
+			circuit = unbalanced == 0;
+			if (!start.has_value() && n > 0)
+			{
+				start = 0;
+			}
+			return start;
+		}
+
+		/**
+		 * @brief Hierholzer's algorithm over a graph in CSR format, in time linear in the number of edges.
+		 * Every node has a cursor on its outgoing arcs, so every arc is looked at once, and the edges
+		 * are marked in a bitmap when they are used, so the two arcs of an undirected edge are
+		 * traversed only once. The walk is an explicit stack: a node with no unused arcs left is
+		 * popped and closes the path backward.
+		 *
+		 * @param outOffset start of the outgoing arcs of every node (size n + 1)
+		 * @param outTarget head of every outgoing arc
+		 * @param outEdge edge of every outgoing arc, in [0, numberOfEdges)
+		 * @param numberOfEdges number of edges
+		 * @param start start node of the path
+		 * @param nodePath output nodes of the path, numberOfEdges + 1 if it is eulerian
+		 * @param edgePath output edges of the path, edgePath[i] goes from nodePath[i] to nodePath[i + 1]
+		 * @return true if the path uses all the edges, false if the edges are not connected
+		 */
+		inline bool csrHierholzer(const std::vector<std::size_t> &outOffset, const std::vector<std::size_t> &outTarget, const std::vector<std::size_t> &outEdge, std::size_t numberOfEdges, std::size_t start, std::vector<std::size_t> &nodePath, std::vector<std::size_t> &edgePath)
+		{
+			std::vector<std::size_t> cursor(outOffset.begin(), outOffset.end() - 1);
+			std::vector<bool> used(numberOfEdges, false);
+			std::vector<std::pair<std::size_t, std::size_t>> stack; // node and the edge that reached it
+			stack.reserve(numberOfEdges + 1);
+			nodePath.clear();
+			edgePath.clear();
+			stack.emplace_back(start, NOT_VISITED);
+			while (!stack.empty())
+			{
+				auto node = stack.back().first;
+				auto &arc = cursor[node];
+				while (arc < outOffset[node + 1] && used[outEdge[arc]])
+				{
+					++arc;
+				}
+				if (arc == outOffset[node + 1])
+				{
+					nodePath.push_back(node);
+					if (stack.back().second != NOT_VISITED)
+					{
+						edgePath.push_back(stack.back().second);
+					}
+					stack.pop_back();
+					continue;
+				}
+				used[outEdge[arc]] = true;
+				stack.emplace_back(outTarget[arc], outEdge[arc]);
+				++arc;
+			}
+			std::reverse(nodePath.begin(), nodePath.end());
+			std::reverse(edgePath.begin(), edgePath.end());
+			return edgePath.size() == numberOfEdges;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_EULERIANPATH_H__
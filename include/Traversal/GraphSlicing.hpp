@@ -0,0 +1,97 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_GRAPHSLICING_H__
+#define __CXXGRAPH_TRAVERSAL_GRAPHSLICING_H__
+
+#pragma once
+
+#include <vector>
+
+#include "Traversal/ConcurrentBFS.hpp"
+#include "Traversal/DepthFirstSearch.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Graph slicing based on connectivity over an adjacency in CSR format.
+		 * C is the set of nodes reachable from start and M the set of nodes reachable from any node
+		 * not in C: the slice is C minus M. C is found by a traversal from start, M by a single
+		 * traversal from all the nodes not in C together, so the cost is linear in the size of the graph.
+		 * With one thread C is visited depth first and the slice keeps the order of depth_first_search,
+		 * with more threads both traversals are parallel breadth first searches and the slice is in
+		 * breadth first order.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param start dense index of the start node
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param slice output nodes of the slice
+		 */
+		inline void csrGraphSlicing(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, std::size_t start, unsigned int numberOfThreads, std::vector<std::size_t> &slice)
+		{
+			const auto n = offset.size() - 1;
+			std::vector<std::size_t> reachable;
+			if (numberOfThreads <= 1)
+			{
+				DepthFirstSearch dfs(offset, adjacency);
+				dfs.run(start, [&reachable](std::size_t node)
+						{ reachable.push_back(node); });
+			}
+			else
+			{
+				csrConcurrentBFS(offset, adjacency, start, numberOfThreads, reachable);
+			}
+
+			std::vector<char> inSlice(n, 0);
+			for (auto node : reachable)
+			{
+				inSlice[node] = 1;
+			}
+			std::vector<std::size_t> complement;
+			complement.reserve(n - reachable.size());
+			for (std::size_t node = 0; node < n; ++node)
+			{
+				if (!inSlice[node])
+				{
+					complement.push_back(node);
+				}
+			}
+			std::vector<std::size_t> reachableFromComplement;
+			csrConcurrentMultiSourceBFS(offset, adjacency, complement, numberOfThreads, reachableFromComplement);
+			for (auto node : reachableFromComplement)
+			{
+				inSlice[node] = 0;
+			}
+
+			slice.clear();
+			for (auto node : reachable)
+			{
+				if (inSlice[node])
+				{
+					slice.push_back(node);
+				}
+			}
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_GRAPHSLICING_H__
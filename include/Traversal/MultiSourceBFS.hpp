@@ -0,0 +1,176 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_MULTISOURCEBFS_H__
+#define __CXXGRAPH_TRAVERSAL_MULTISOURCEBFS_H__
+
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Bit-parallel breadth first search of up to 64 * Words sources at once (MS-BFS, Then et al.).
+		 * Every node has a mask of Words 64 bits words for the sources that have seen it, that visit it
+		 * in the current level and that reach it in the next one, so a single scan of the arcs of a node
+		 * expands the searches of all the sources that are at that node in the same level.
+		 * The masks have a fixed size, and the loops on their words are vectorized by the compiler.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param sources dense indices of the sources, bit i of the masks is sources[i]
+		 * @param count number of sources, at most 64 * Words
+		 * @param visitor called as visitor(node, depth, mask) once for every node and level with the
+		 * Words words mask of the sources that reach the node at that depth
+		 */
+		template <std::size_t Words, typename Visitor>
+		void csrMultiSourceBFSBatch(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, const std::size_t *sources, std::size_t count, Visitor &&visitor)
+		{
+			using Mask = std::array<uint64_t, Words>;
+			const auto n = offset.size() - 1;
+			std::vector<Mask> seen(n, Mask{}), visit(n, Mask{}), next(n, Mask{});
+			auto any = [](const Mask &mask)
+			{
+				uint64_t bits = 0;
+				for (std::size_t w = 0; w < Words; ++w)
+				{
+					bits |= mask[w];
+				}
+				return bits != 0;
+			};
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				seen[sources[i]][i >> 6] |= uint64_t(1) << (i & 63);
+				visit[sources[i]][i >> 6] |= uint64_t(1) << (i & 63);
+			}
+			for (std::size_t v = 0; v < n; ++v)
+			{
+				if (any(visit[v]))
+				{
+					visitor(v, std::size_t(0), visit[v].data());
+				}
+			}
+
+			bool active = true;
+			for (std::size_t depth = 1; active; ++depth)
+			{
+				active = false;
+				for (std::size_t v = 0; v < n; ++v)
+				{
+					if (!any(visit[v]))
+					{
+						continue;
+					}
+					const auto &mask = visit[v];
+					for (auto arc = offset[v]; arc < offset[v + 1]; ++arc)
+					{
+						auto &target = next[adjacency[arc]];
+						for (std::size_t w = 0; w < Words; ++w)
+						{
+							target[w] |= mask[w];
+						}
+					}
+				}
+				for (std::size_t v = 0; v < n; ++v)
+				{
+					auto &reached = next[v];
+					for (std::size_t w = 0; w < Words; ++w)
+					{
+						reached[w] &= ~seen[v][w];
+						seen[v][w] |= reached[w];
+					}
+					if (any(reached))
+					{
+						visitor(v, depth, reached.data());
+						active = true;
+					}
+					// the visit masks of this level are cleared to become the next masks
+					visit[v] = Mask{};
+				}
+				visit.swap(next);
+			}
+		}
+
+		/**
+		 * @brief Breadth first searches from all the sources, in batches of 64, 256 or 512 sources
+		 * that are expanded together by csrMultiSourceBFSBatch. The batches are split between threads.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param sources dense indices of the sources
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param visitor called as visitor(source, node, depth) for every source and every node it reaches,
+		 * where source is the position in sources; the calls of a source are made by a single thread
+		 */
+		template <typename Visitor>
+		void csrMultiSourceBFS(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, const std::vector<std::size_t> &sources, unsigned int numberOfThreads, Visitor &&visitor)
+		{
+			auto runBatches = [&](auto words)
+			{
+				constexpr std::size_t Words = decltype(words)::value;
+				constexpr std::size_t batchSize = 64 * Words;
+				const auto batches = (sources.size() + batchSize - 1) / batchSize;
+				parallelFor(0, batches, numberOfThreads, 1, [&](std::size_t begin, std::size_t end, unsigned int)
+							{
+								for (auto batch = begin; batch < end; ++batch)
+								{
+									const auto first = batch * batchSize;
+									const auto count = std::min(batchSize, sources.size() - first);
+									csrMultiSourceBFSBatch<Words>(offset, adjacency, sources.data() + first, count, [&](std::size_t node, std::size_t depth, const uint64_t *mask)
+																  {
+																	  for (std::size_t w = 0; w < Words; ++w)
+																	  {
+																		  auto bits = mask[w];
+																		  for (std::size_t bit = 0; bits; ++bit, bits >>= 1)
+																		  {
+																			  if (bits & 1)
+																			  {
+																				  visitor(first + w * 64 + bit, node, depth);
+																			  }
+																		  }
+																	  } });
+								}
+							});
+			};
+			if (sources.size() <= 64)
+			{
+				runBatches(std::integral_constant<std::size_t, 1>());
+			}
+			else if (sources.size() <= 256)
+			{
+				runBatches(std::integral_constant<std::size_t, 4>());
+			}
+			else
+			{
+				runBatches(std::integral_constant<std::size_t, 8>());
+			}
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_MULTISOURCEBFS_H__
@@ -0,0 +1,164 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_PARALLELBORUVKA_H__
+#define __CXXGRAPH_TRAVERSAL_PARALLELBORUVKA_H__
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <numeric>
+#include <algorithm>
+
+#include "Traversal/ConcurrentBFS.hpp"
+#include "Traversal/ConnectedComponents.hpp"
+#include "Traversal/DirectionOptimizingBFS.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Parallel Boruvka minimum spanning forest over the edge arrays of a graph.
+		 * Every round has three parallel phases over the edges that still join two components:
+		 * - the cheapest edge of every component is the minimum of the edges of its nodes, kept in an
+		 *   atomic slot per component and lowered with a compare and swap loop;
+		 * - every component is hooked below the component at the other end of its cheapest edge, that
+		 *   enters the forest; when two components chose the same edge only the one with the higher
+		 *   index is hooked, so the hooks form a forest;
+		 * - the trees of the union-find are compressed and the edges inside a component are dropped.
+		 * The edges are ordered by weight and then by index, so the forest is unique and does not
+		 * depend on the number of threads. Every round at least halves the components.
+		 *
+		 * @param numberOfNodes number of nodes
+		 * @param edgeFrom first node of every edge
+		 * @param edgeTo second node of every edge
+		 * @param edgeWeight weight of every edge
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param forestEdges output edges of the minimum spanning forest, in order of index
+		 */
+		inline void csrParallelBoruvka(std::size_t numberOfNodes, const std::vector<std::size_t> &edgeFrom, const std::vector<std::size_t> &edgeTo, const std::vector<double> &edgeWeight, unsigned int numberOfThreads, std::vector<std::size_t> &forestEdges)
+		{
+			const auto n = numberOfNodes;
+			const auto m = edgeFrom.size();
+			const auto threads = std::max(numberOfThreads, 1u);
+			forestEdges.clear();
+
+			std::vector<std::atomic<std::size_t>> parent(n);
+			std::vector<std::size_t> component(n);
+			std::vector<std::atomic<std::size_t>> cheapest(n);
+			parallelFor(0, n, threads, BORUVKA_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								parent[node].store(node, std::memory_order_relaxed);
+								component[node] = node;
+								cheapest[node].store(NOT_VISITED, std::memory_order_relaxed);
+							} });
+			auto lighter = [&edgeWeight](std::size_t a, std::size_t b)
+			{
+				return edgeWeight[a] < edgeWeight[b] || (edgeWeight[a] == edgeWeight[b] && a < b);
+			};
+			auto offer = [&](std::size_t root, std::size_t edge)
+			{
+				auto current = cheapest[root].load(std::memory_order_relaxed);
+				while ((current == NOT_VISITED || lighter(edge, current)) &&
+					   !cheapest[root].compare_exchange_weak(current, edge, std::memory_order_relaxed))
+				{
+				}
+			};
+
+			// the edges between two different components, the self loops are dropped
+			std::vector<std::size_t> active;
+			std::vector<std::vector<std::size_t>> localList(threads);
+			auto filter = [&](const std::vector<std::size_t> *edges, std::size_t size)
+			{
+				std::vector<std::size_t> next;
+				parallelFor(0, size, threads, BORUVKA_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+							{
+								for (auto i = begin; i < end; ++i)
+								{
+									auto edge = edges == nullptr ? i : (*edges)[i];
+									if (component[edgeFrom[edge]] != component[edgeTo[edge]])
+									{
+										localList[threadId].push_back(edge);
+									}
+								} });
+				concatenateLocalLists(localList, next, threads);
+				return next;
+			};
+			active = filter(nullptr, m);
+
+			std::vector<char> inForest(m, 0);
+			while (!active.empty())
+			{
+				parallelFor(0, active.size(), threads, BORUVKA_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+							{
+								for (auto i = begin; i < end; ++i)
+								{
+									auto edge = active[i];
+									offer(component[edgeFrom[edge]], edge);
+									offer(component[edgeTo[edge]], edge);
+								} });
+
+				// every root writes only its own parent, the components are read from the snapshot of the round
+				parallelFor(0, n, threads, BORUVKA_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+							{
+								for (auto root = begin; root < end; ++root)
+								{
+									auto edge = cheapest[root].load(std::memory_order_relaxed);
+									if (component[root] != root || edge == NOT_VISITED)
+									{
+										continue;
+									}
+									auto other = component[edgeFrom[edge]] == root ? component[edgeTo[edge]] : component[edgeFrom[edge]];
+									if (cheapest[other].load(std::memory_order_relaxed) == edge && root < other)
+									{
+										continue;
+									}
+									parent[root].store(other, std::memory_order_relaxed);
+									inForest[edge] = 1;
+								} });
+
+				concurrentCompress(parent, threads);
+				parallelFor(0, n, threads, BORUVKA_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int)
+							{
+								for (auto node = begin; node < end; ++node)
+								{
+									component[node] = parent[node].load(std::memory_order_relaxed);
+									cheapest[node].store(NOT_VISITED, std::memory_order_relaxed);
+								} });
+				active = filter(&active, active.size());
+			}
+
+			for (std::size_t edge = 0; edge < m; ++edge)
+			{
+				if (inForest[edge])
+				{
+					forestEdges.push_back(edge);
+				}
+			}
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_PARALLELBORUVKA_H__
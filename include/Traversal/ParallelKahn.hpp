@@ -0,0 +1,105 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_PARALLELKAHN_H__
+#define __CXXGRAPH_TRAVERSAL_PARALLELKAHN_H__
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "Traversal/ConcurrentBFS.hpp"
+#include "Traversal/DirectionOptimizingBFS.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Level synchronous parallel Kahn topological sort over a graph in CSR format.
+		 * The in-degree of every node is an atomic counter, the frontier of a level is the range of the
+		 * order with the nodes whose counter reached zero during the previous level: the threads
+		 * decrement the counters of the heads of its arcs, and the thread that brings a counter to zero
+		 * appends the node to its local list for the next level, so the levels are the same for any
+		 * number of threads. The level of a node is the length of the longest path that ends in it.
+		 * The nodes on a cycle, or reachable from one, never reach zero: the graph is acyclic if and
+		 * only if all the nodes are ordered.
+		 *
+		 * @param outOffset start of the outgoing arcs of every node (size n + 1)
+		 * @param outTarget head of every outgoing arc
+		 * @param inOffset start of the incoming arcs of every node (size n + 1)
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param order output ordered nodes, level by level
+		 * @param level output level of every node, NOT_VISITED for the nodes not ordered
+		 * @return true if the graph is acyclic
+		 */
+		inline bool csrParallelKahn(const std::vector<std::size_t> &outOffset, const std::vector<std::size_t> &outTarget, const std::vector<std::size_t> &inOffset, unsigned int numberOfThreads, std::vector<std::size_t> &order, std::vector<std::size_t> &level)
+		{
+			const auto n = outOffset.size() - 1;
+			const auto threads = std::max(numberOfThreads, 1u);
+			std::vector<std::atomic<std::size_t>> inDegree(n);
+			std::vector<std::vector<std::size_t>> localList(threads);
+			order.clear();
+			level.assign(n, NOT_VISITED);
+			parallelFor(0, n, threads, BFS_BOTTOM_UP_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								inDegree[node].store(inOffset[node + 1] - inOffset[node], std::memory_order_relaxed);
+								if (inOffset[node] == inOffset[node + 1])
+								{
+									level[node] = 0;
+									localList[threadId].push_back(node);
+								}
+							} });
+			concatenateLocalLists(localList, order, threads);
+
+			std::size_t levelBegin = 0;
+			for (std::size_t depth = 1; levelBegin < order.size(); ++depth)
+			{
+				const auto levelEnd = order.size();
+				parallelFor(levelBegin, levelEnd, threads, BFS_TOP_DOWN_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+							{
+								auto &local = localList[threadId];
+								for (auto i = begin; i < end; ++i)
+								{
+									auto u = order[i];
+									for (auto arc = outOffset[u]; arc < outOffset[u + 1]; ++arc)
+									{
+										auto v = outTarget[arc];
+										if (inDegree[v].fetch_sub(1, std::memory_order_acq_rel) == 1)
+										{
+											level[v] = depth;
+											local.push_back(v);
+										}
+									}
+								} });
+				concatenateLocalLists(localList, order, threads);
+				levelBegin = levelEnd;
+			}
+			return order.size() == n;
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_PARALLELKAHN_H__
@@ -0,0 +1,393 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_STRONGLYCONNECTEDCOMPONENTS_H__
+#define __CXXGRAPH_TRAVERSAL_STRONGLYCONNECTEDCOMPONENTS_H__
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <utility>
+#include <algorithm>
+
+#include "Traversal/ConcurrentBFS.hpp"
+#include "Traversal/DirectionOptimizingBFS.hpp"
+#include "Utility/AtomicBitmap.hpp"
+#include "Utility/ConstValue.hpp"
+#include "Utility/ParallelFor.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/**
+		 * @brief Iterative Tarjan search of the strongly connected components of the subgraph induced by nodes.
+		 * The call stack of the recursive algorithm is an explicit stack of (node, next arc), the arcs
+		 * to the nodes not accepted are skipped. The components are numbered by newComponent() when they
+		 * are completed, that is in reverse topological order of the condensation.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param nodes dense indices of the nodes of the subgraph
+		 * @param accept tells if a node is in the subgraph
+		 * @param localIndex position of a node of the subgraph in nodes
+		 * @param newComponent returns the id of a new component
+		 * @param componentId output component of every node of the subgraph, the other entries are not touched
+		 */
+		template <typename Accept, typename LocalIndex, typename NewComponent>
+		void csrTarjanSubgraphSCC(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, const std::vector<std::size_t> &nodes, Accept &&accept, LocalIndex &&localIndex, NewComponent &&newComponent, std::vector<std::size_t> &componentId)
+		{
+			std::vector<std::size_t> discovery(nodes.size(), NOT_VISITED);
+			std::vector<std::size_t> lowlink(nodes.size());
+			std::vector<bool> onStack(nodes.size(), false);
+			std::vector<std::size_t> componentStack;
+			std::vector<std::pair<std::size_t, std::size_t>> callStack; // node and its next arc
+			std::size_t counter = 0;
+			auto discover = [&](std::size_t node)
+			{
+				auto local = localIndex(node);
+				discovery[local] = lowlink[local] = counter++;
+				onStack[local] = true;
+				componentStack.push_back(node);
+				callStack.emplace_back(node, offset[node]);
+			};
+
+			for (auto root : nodes)
+			{
+				if (discovery[localIndex(root)] != NOT_VISITED)
+				{
+					continue;
+				}
+				discover(root);
+				while (!callStack.empty())
+				{
+					auto &[node, arc] = callStack.back();
+					auto local = localIndex(node);
+					if (arc < offset[node + 1])
+					{
+						auto next = adjacency[arc++];
+						if (!accept(next))
+						{
+							continue;
+						}
+						auto nextLocal = localIndex(next);
+						if (discovery[nextLocal] == NOT_VISITED)
+						{
+							// node and arc are not used after the push, that can move the stack
+							discover(next);
+						}
+						else if (onStack[nextLocal])
+						{
+							lowlink[local] = std::min(lowlink[local], discovery[nextLocal]);
+						}
+						continue;
+					}
+					auto finished = node;
+					callStack.pop_back();
+					if (lowlink[local] == discovery[local])
+					{
+						auto component = newComponent();
+						std::size_t member;
+						do
+						{
+							member = componentStack.back();
+							componentStack.pop_back();
+							onStack[localIndex(member)] = false;
+							componentId[member] = component;
+						} while (member != finished);
+					}
+					if (!callStack.empty())
+					{
+						auto parent = localIndex(callStack.back().first);
+						lowlink[parent] = std::min(lowlink[parent], lowlink[local]);
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief Strongly connected components of a graph in CSR format with an iterative Tarjan search.
+		 * The time is linear in the size of the graph and the depth is not limited by the stack of the thread.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param componentId output component of every node, in reverse topological order of the condensation
+		 * @return the number of components
+		 */
+		inline std::size_t csrTarjanSCC(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, std::vector<std::size_t> &componentId)
+		{
+			const auto n = offset.size() - 1;
+			std::vector<std::size_t> nodes(n);
+			for (std::size_t node = 0; node < n; ++node)
+			{
+				nodes[node] = node;
+			}
+			componentId.assign(n, NOT_VISITED);
+			std::size_t numberOfComponents = 0;
+			csrTarjanSubgraphSCC(
+				offset, adjacency, nodes, [](std::size_t)
+				{ return true; },
+				[](std::size_t node)
+				{ return node; },
+				[&numberOfComponents]()
+				{ return numberOfComponents++; },
+				componentId);
+			return numberOfComponents;
+		}
+
+		/**
+		 * @brief Level synchronous parallel breadth first search from source where a node is visited by
+		 * the thread for which claim(node) returns true, claim is expected to be an atomic operation
+		 * (e.g. a compare and swap of the color of the node). The source is already claimed.
+		 *
+		 * @param offset start of the adjacency range of every node (size n + 1)
+		 * @param adjacency head of every arc
+		 * @param source dense index of the source node
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param claim tries to visit a node
+		 * @param order output visited nodes, level by level
+		 */
+		template <typename Claim>
+		void csrClaimingBFS(const std::vector<std::size_t> &offset, const std::vector<std::size_t> &adjacency, std::size_t source, unsigned int numberOfThreads, Claim &&claim, std::vector<std::size_t> &order)
+		{
+			const auto threads = std::max(numberOfThreads, 1u);
+			std::vector<std::vector<std::size_t>> localList(threads);
+			order.assign(1, source);
+			std::size_t levelBegin = 0;
+			while (levelBegin < order.size())
+			{
+				const auto levelEnd = order.size();
+				parallelFor(levelBegin, levelEnd, threads, BFS_TOP_DOWN_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+							{
+								auto &local = localList[threadId];
+								for (auto i = begin; i < end; ++i)
+								{
+									auto u = order[i];
+									for (auto arc = offset[u]; arc < offset[u + 1]; ++arc)
+									{
+										auto v = adjacency[arc];
+										if (claim(v))
+										{
+											local.push_back(v);
+										}
+									}
+								} });
+				concatenateLocalLists(localList, order, threads);
+				levelBegin = levelEnd;
+			}
+		}
+
+		/**
+		 * @brief Parallel strongly connected components of a graph in CSR format, forward-backward with trimming.
+		 * - trimming: the nodes without incoming or outgoing arcs among the remaining nodes are components
+		 *   of a single node, they are peeled level by level with atomic degree counters;
+		 * - forward-backward: every subproblem is a set of nodes of the same color. The nodes reached from
+		 *   a pivot both forward and backward inside the subproblem are its component, and the nodes
+		 *   reached only forward, only backward or not at all are three new subproblems, since no
+		 *   component crosses them. The searches are parallel breadth first searches that claim the
+		 *   nodes with a compare and swap of their color;
+		 * - the subproblems with less than SCC_SEQUENTIAL_SIZE nodes are solved in parallel with one
+		 *   sequential Tarjan search each.
+		 * The ids of the components are a labelling of the partition, their order depends on the scheduling.
+		 *
+		 * @param outOffset start of the outgoing arcs of every node (size n + 1)
+		 * @param outTarget head of every outgoing arc
+		 * @param inOffset start of the incoming arcs of every node (size n + 1)
+		 * @param inSource tail of every incoming arc
+		 * @param numberOfThreads number of threads (1 = sequential)
+		 * @param componentId output component of every node
+		 * @return the number of components
+		 */
+		inline std::size_t csrForwardBackwardSCC(const std::vector<std::size_t> &outOffset, const std::vector<std::size_t> &outTarget, const std::vector<std::size_t> &inOffset, const std::vector<std::size_t> &inSource, unsigned int numberOfThreads, std::vector<std::size_t> &componentId)
+		{
+			const auto n = outOffset.size() - 1;
+			const auto threads = std::max(numberOfThreads, 1u);
+			componentId.assign(n, NOT_VISITED);
+			std::atomic<std::size_t> nextComponent(0);
+
+			// trimming
+			std::vector<std::atomic<std::size_t>> inDegree(n);
+			std::vector<std::atomic<std::size_t>> outDegree(n);
+			AtomicBitmap trimmed(n);
+			std::vector<std::vector<std::size_t>> localList(threads);
+			std::vector<std::size_t> peeled;
+			parallelFor(0, n, threads, BFS_BOTTOM_UP_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+						{
+							for (auto node = begin; node < end; ++node)
+							{
+								inDegree[node].store(inOffset[node + 1] - inOffset[node], std::memory_order_relaxed);
+								outDegree[node].store(outOffset[node + 1] - outOffset[node], std::memory_order_relaxed);
+								if (inOffset[node] == inOffset[node + 1] || outOffset[node] == outOffset[node + 1])
+								{
+									trimmed.testAndSet(node);
+									localList[threadId].push_back(node);
+								}
+							} });
+			concatenateLocalLists(localList, peeled, threads);
+			std::size_t levelBegin = 0;
+			while (levelBegin < peeled.size())
+			{
+				const auto levelEnd = peeled.size();
+				const auto firstComponent = nextComponent.fetch_add(levelEnd - levelBegin);
+				parallelFor(levelBegin, levelEnd, threads, BFS_TOP_DOWN_GRAIN, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+							{
+								auto &local = localList[threadId];
+								auto peel = [&](std::size_t v, std::atomic<std::size_t> &degree)
+								{
+									if (!trimmed.test(v) && degree.fetch_sub(1) == 1 && trimmed.testAndSet(v))
+									{
+										local.push_back(v);
+									}
+								};
+								for (auto i = begin; i < end; ++i)
+								{
+									auto u = peeled[i];
+									componentId[u] = firstComponent + i - levelBegin;
+									for (auto arc = outOffset[u]; arc < outOffset[u + 1]; ++arc)
+									{
+										peel(outTarget[arc], inDegree[outTarget[arc]]);
+									}
+									for (auto arc = inOffset[u]; arc < inOffset[u + 1]; ++arc)
+									{
+										peel(inSource[arc], outDegree[inSource[arc]]);
+									}
+								} });
+				concatenateLocalLists(localList, peeled, threads);
+				levelBegin = levelEnd;
+			}
+
+			// forward-backward on the remaining nodes, all of color 0
+			const auto done = NOT_VISITED;
+			std::vector<std::atomic<std::size_t>> color(n);
+			std::vector<std::size_t> remaining;
+			for (std::size_t node = 0; node < n; ++node)
+			{
+				color[node].store(trimmed.test(node) ? done : 0, std::memory_order_relaxed);
+				if (!trimmed.test(node))
+				{
+					remaining.push_back(node);
+				}
+			}
+			std::size_t nextColor = 1;
+			std::vector<std::pair<std::size_t, std::vector<std::size_t>>> large; // color and nodes of every subproblem
+			std::vector<std::pair<std::size_t, std::vector<std::size_t>>> small;
+			if (!remaining.empty())
+			{
+				large.emplace_back(0, std::move(remaining));
+			}
+			std::vector<std::size_t> forward;
+			std::vector<std::size_t> backward;
+			while (!large.empty())
+			{
+				auto subproblem = std::move(large.back());
+				large.pop_back();
+				const auto subColor = subproblem.first;
+				auto &nodes = subproblem.second;
+				if (nodes.size() < SCC_SEQUENTIAL_SIZE)
+				{
+					small.emplace_back(subColor, std::move(nodes));
+					continue;
+				}
+				const auto pivot = nodes.front();
+				const auto forwardColor = nextColor++;
+				const auto backwardColor = nextColor++;
+				color[pivot].store(forwardColor);
+				csrClaimingBFS(outOffset, outTarget, pivot, threads, [&color, subColor, forwardColor](std::size_t v)
+							   {
+								   auto expected = subColor;
+								   return color[v].compare_exchange_strong(expected, forwardColor); },
+							   forward);
+				// the nodes reached both forward and backward are done, the others reached backward get backwardColor
+				color[pivot].store(done);
+				csrClaimingBFS(inOffset, inSource, pivot, threads, [&color, subColor, forwardColor, backwardColor, done](std::size_t v)
+							   {
+								   auto expected = forwardColor;
+								   if (color[v].compare_exchange_strong(expected, done))
+								   {
+									   return true;
+								   }
+								   expected = subColor;
+								   return color[v].compare_exchange_strong(expected, backwardColor); },
+							   backward);
+				const auto component = nextComponent.fetch_add(1);
+				std::vector<std::size_t> forwardOnly;
+				std::vector<std::size_t> backwardOnly;
+				std::vector<std::size_t> unreached;
+				for (auto node : nodes)
+				{
+					auto nodeColor = color[node].load(std::memory_order_relaxed);
+					if (nodeColor == done)
+					{
+						componentId[node] = component;
+					}
+					else if (nodeColor == forwardColor)
+					{
+						forwardOnly.push_back(node);
+					}
+					else if (nodeColor == backwardColor)
+					{
+						backwardOnly.push_back(node);
+					}
+					else
+					{
+						unreached.push_back(node);
+					}
+				}
+				if (!forwardOnly.empty())
+				{
+					large.emplace_back(forwardColor, std::move(forwardOnly));
+				}
+				if (!backwardOnly.empty())
+				{
+					large.emplace_back(backwardColor, std::move(backwardOnly));
+				}
+				if (!unreached.empty())
+				{
+					large.emplace_back(subColor, std::move(unreached));
+				}
+			}
+
+			// every node belongs to one subproblem, so its position is written by a single thread
+			std::vector<std::size_t> position(n);
+			parallelFor(0, small.size(), threads, 1, [&](std::size_t begin, std::size_t end, unsigned int)
+						{
+							for (auto s = begin; s < end; ++s)
+							{
+								const auto subColor = small[s].first;
+								const auto &nodes = small[s].second;
+								for (std::size_t i = 0; i < nodes.size(); ++i)
+								{
+									position[nodes[i]] = i;
+								}
+								csrTarjanSubgraphSCC(
+									outOffset, outTarget, nodes, [&color, subColor](std::size_t v)
+									{ return color[v].load(std::memory_order_relaxed) == subColor; },
+									[&position](std::size_t v)
+									{ return position[v]; },
+									[&nextComponent]()
+									{ return nextComponent.fetch_add(1); },
+									componentId);
+							} });
+			return nextComponent.load();
+		}
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_STRONGLYCONNECTEDCOMPONENTS_H__
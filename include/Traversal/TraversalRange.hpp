@@ -0,0 +1,261 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_TRAVERSAL_TRAVERSALRANGE_H__
+#define __CXXGRAPH_TRAVERSAL_TRAVERSALRANGE_H__
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <iterator>
+#include <optional>
+
+#include "Graph/CSRGraph.hpp"
+
+namespace CXXGRAPH
+{
+	namespace TRAVERSAL
+	{
+		/// A node reached by a traversal, with its depth in the traversal tree and the node that reached it
+		template <typename T>
+		struct TraversalStep_struct
+		{
+			const Node<T> *node = nullptr;	 // reached node
+			std::size_t depth = 0;			 // number of tree edges from the start node
+			const Node<T> *parent = nullptr; // node that reached it, nullptr for the start node
+		};
+		template <typename T>
+		using TraversalStep = TraversalStep_struct<T>;
+
+		/// Single pass input iterator over a traversal range, that advances the traversal on demand
+		template <typename Range>
+		class TraversalIterator
+		{
+		private:
+			Range *range = nullptr; // nullptr for the end iterator
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = typename Range::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type *;
+			using reference = const value_type &;
+
+			TraversalIterator() = default;
+			explicit TraversalIterator(Range *range) : range(range && range->finished() ? nullptr : range) {}
+
+			reference operator*() const
+			{
+				return range->current();
+			}
+			pointer operator->() const
+			{
+				return &range->current();
+			}
+			TraversalIterator &operator++()
+			{
+				range->advance();
+				if (range->finished())
+				{
+					range = nullptr;
+				}
+				return *this;
+			}
+			bool operator==(const TraversalIterator &other) const
+			{
+				return range == other.range;
+			}
+			bool operator!=(const TraversalIterator &other) const
+			{
+				return range != other.range;
+			}
+		};
+
+		/// Lazy breadth first traversal of a CSRGraph from a start node.
+		/// The neighbours of a node are enqueued only when the node is yielded, so the work done is
+		/// proportional to the nodes consumed by the caller, and leaving the loop stops the traversal.
+		/// The range keeps the snapshot alive and can be iterated only once.
+		template <typename T>
+		class BreadthFirstRange
+		{
+		private:
+			struct Entry
+			{
+				std::size_t node;
+				std::size_t depth;
+				std::size_t parent;
+			};
+			std::shared_ptr<const CSRGraph<T>> csr;
+			std::vector<bool> visited = {};
+			std::deque<Entry> queue = {};
+			TraversalStep<T> step = {};
+			bool done = true;
+
+		public:
+			using value_type = TraversalStep<T>;
+			using iterator = TraversalIterator<BreadthFirstRange<T>>;
+
+			/**
+			 * @param csr snapshot of the graph
+			 * @param start start node, the range is empty if it is not in the snapshot
+			 */
+			BreadthFirstRange(std::shared_ptr<const CSRGraph<T>> csr, const Node<T> *start) : csr(std::move(csr))
+			{
+				auto index = this->csr->getIndex(start);
+				if (index.has_value())
+				{
+					visited.assign(this->csr->getNumberOfNodes(), false);
+					visited[index.value()] = true;
+					queue.push_back({index.value(), 0, index.value()});
+					done = false;
+					advance();
+				}
+			}
+			BreadthFirstRange(const BreadthFirstRange &) = delete;
+			BreadthFirstRange(BreadthFirstRange &&) = default;
+			~BreadthFirstRange() = default;
+
+			iterator begin()
+			{
+				return iterator(this);
+			}
+			iterator end()
+			{
+				return iterator();
+			}
+			bool finished() const
+			{
+				return done;
+			}
+			const TraversalStep<T> &current() const
+			{
+				return step;
+			}
+			/// Move to the next node, enqueuing the unvisited neighbours of the current one
+			void advance()
+			{
+				if (queue.empty())
+				{
+					done = true;
+					return;
+				}
+				auto entry = queue.front();
+				queue.pop_front();
+				const auto &offset = csr->getOutOffset();
+				const auto &target = csr->getOutTarget();
+				for (auto arc = offset[entry.node]; arc < offset[entry.node + 1]; ++arc)
+				{
+					if (!visited[target[arc]])
+					{
+						visited[target[arc]] = true;
+						queue.push_back({target[arc], entry.depth + 1, entry.node});
+					}
+				}
+				step.node = csr->getNode(entry.node);
+				step.depth = entry.depth;
+				step.parent = entry.depth == 0 ? nullptr : csr->getNode(entry.parent);
+			}
+		};
+
+		/// Lazy depth first traversal (pre-order) of a CSRGraph from a start node, with an explicit stack.
+		/// Only the arcs needed to find the next node are scanned, and leaving the loop stops the traversal.
+		/// The range keeps the snapshot alive and can be iterated only once.
+		template <typename T>
+		class DepthFirstRange
+		{
+		private:
+			std::shared_ptr<const CSRGraph<T>> csr;
+			std::vector<bool> visited = {};
+			std::vector<std::pair<std::size_t, std::size_t>> stack = {}; // node and its next arc
+			TraversalStep<T> step = {};
+			bool done = true;
+
+		public:
+			using value_type = TraversalStep<T>;
+			using iterator = TraversalIterator<DepthFirstRange<T>>;
+
+			/**
+			 * @param csr snapshot of the graph
+			 * @param start start node, the range is empty if it is not in the snapshot
+			 */
+			DepthFirstRange(std::shared_ptr<const CSRGraph<T>> csr, const Node<T> *start) : csr(std::move(csr))
+			{
+				auto index = this->csr->getIndex(start);
+				if (index.has_value())
+				{
+					visited.assign(this->csr->getNumberOfNodes(), false);
+					visited[index.value()] = true;
+					stack.emplace_back(index.value(), this->csr->getOutOffset()[index.value()]);
+					step.node = this->csr->getNode(index.value());
+					done = false;
+				}
+			}
+			DepthFirstRange(const DepthFirstRange &) = delete;
+			DepthFirstRange(DepthFirstRange &&) = default;
+			~DepthFirstRange() = default;
+
+			iterator begin()
+			{
+				return iterator(this);
+			}
+			iterator end()
+			{
+				return iterator();
+			}
+			bool finished() const
+			{
+				return done;
+			}
+			const TraversalStep<T> &current() const
+			{
+				return step;
+			}
+			/// Move to the next node not visited, backtracking when a node has no more arcs
+			void advance()
+			{
+				const auto &offset = csr->getOutOffset();
+				const auto &target = csr->getOutTarget();
+				while (!stack.empty())
+				{
+					auto &[node, arc] = stack.back();
+					if (arc == offset[node + 1])
+					{
+						stack.pop_back();
+						continue;
+					}
+					auto next = target[arc++];
+					if (!visited[next])
+					{
+						visited[next] = true;
+						step.node = csr->getNode(next);
+						step.depth = stack.size();
+						step.parent = csr->getNode(node);
+						stack.emplace_back(next, offset[next]);
+						return;
+					}
+				}
+				done = true;
+			}
+		};
+	}
+}
+
+#endif // __CXXGRAPH_TRAVERSAL_TRAVERSALRANGE_H__
@@ -0,0 +1,85 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_ATOMICBITMAP_H__
+#define __CXXGRAPH_ATOMICBITMAP_H__
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+namespace CXXGRAPH
+{
+	/// Bitmap of a fixed number of bits, that can be set concurrently by several threads.
+	/// A bit is claimed with a fetch_or on its 64 bits word, so only one thread sees it unset.
+	class AtomicBitmap
+	{
+	private:
+		std::vector<std::atomic<uint64_t>> words;
+		std::size_t bits = 0;
+
+	public:
+		explicit AtomicBitmap(std::size_t size) : words((size + 63) / 64), bits(size)
+		{
+			clear();
+		}
+		~AtomicBitmap() = default;
+
+		std::size_t size() const
+		{
+			return bits;
+		}
+		std::size_t getNumberOfWords() const
+		{
+			return words.size();
+		}
+		uint64_t getWord(std::size_t word) const
+		{
+			return words[word].load(std::memory_order_relaxed);
+		}
+		bool test(std::size_t index) const
+		{
+			return (words[index >> 6].load(std::memory_order_relaxed) >> (index & 63)) & 1;
+		}
+		/**
+		 * @brief Set the bit of the given index
+		 * @return true if the bit was unset and this call set it, false if it was already set
+		 */
+		bool testAndSet(std::size_t index)
+		{
+			const uint64_t mask = uint64_t(1) << (index & 63);
+			if (words[index >> 6].load(std::memory_order_relaxed) & mask)
+			{
+				return false;
+			}
+			return !(words[index >> 6].fetch_or(mask, std::memory_order_relaxed) & mask);
+		}
+		void clear()
+		{
+			for (auto &word : words)
+			{
+				word.store(0, std::memory_order_relaxed);
+			}
+		}
+	};
+}
+
+#endif // __CXXGRAPH_ATOMICBITMAP_H__
@@ -35,6 +35,16 @@ namespace CXXGRAPH
 	constexpr char ERR_TARGET_NODE_NOT_IN_GRAPH[] = "Target Node not inside Graph";
 	constexpr char ERR_SOURCE_NODE_NOT_IN_GRAPH[] = "Source Node not inside Graph";
 	constexpr char ERR_NOT_STRONG_CONNECTED[] = "Graph is not strongly connected";
+	constexpr char ERR_CH_NOT_BUILT[] = "Contraction Hierarchy not built";
+	constexpr char ERR_ALT_NOT_BUILT[] = "ALT Landmark Index not built";
+	constexpr char ERR_PLL_NOT_BUILT[] = "Pruned Landmark Labeling not built";
+	constexpr char ERR_MIXED_GRAPH[] = "Graph has both directed and undirected edges";
+	constexpr char ERR_NO_EULERIAN_PATH[] = "Graph has no Eulerian path";
+	///////////////////////////////
+
+	//FILE FORMAT CONST EXPRESSION
+	constexpr char CH_FILE_MAGIC[] = "CXXGCH1";
+	constexpr char PLL_FILE_MAGIC[] = "CXXGPLL1";
 	///////////////////////////////
 }
 #endif // __CXXGRAPH_CONSTSTRING_H__
\ No newline at end of file
@@ -23,11 +23,35 @@
 #pragma once
 
 #include <limits>
+#include <cstddef>
 
 namespace CXXGRAPH
 {
     constexpr double INF_DOUBLE = std::numeric_limits<double>::max();
     constexpr double NEGLIGIBLE_WEIGHT = 1e-7;
+    constexpr std::size_t SP_CACHE_DEFAULT_BYTE_BUDGET = 64 * 1024 * 1024;
+    // SPFA Bellman-Ford: a round pulls in parallel over all the nodes when the arcs of the frontier are more than
+    // 1 / SPFA_DENSE_FRONTIER_DIVISOR of the arcs, below that the sequential push over the frontier does less work
+    constexpr std::size_t SPFA_DENSE_FRONTIER_DIVISOR = 8;
+    constexpr std::size_t SPFA_GRAIN = 1024;
+    // direction-optimizing BFS: switch to bottom-up when the arcs of the frontier are more than
+    // 1 / BFS_ALPHA of the unvisited arcs, back to top-down when the frontier is less than 1 / BFS_BETA of the nodes
+    constexpr std::size_t BFS_ALPHA = 14;
+    constexpr std::size_t BFS_BETA = 24;
+    constexpr std::size_t BFS_TOP_DOWN_GRAIN = 64;
+    constexpr std::size_t BFS_BOTTOM_UP_GRAIN = 1024;
+    // concurrent BFS: the next frontier is extracted from the visited bitmap when the arcs
+    // of the frontier are more than 1 / BFS_DENSE_FRONTIER_DIVISOR of the nodes
+    constexpr std::size_t BFS_DENSE_FRONTIER_DIVISOR = 20;
+    // forward-backward SCC: the subproblems with less nodes are solved by sequential Tarjan searches, in parallel
+    constexpr std::size_t SCC_SEQUENTIAL_SIZE = 4096;
+    // Afforest connected components: arcs of every node linked before the sampling of the largest
+    // component, number of nodes sampled, nodes of a parallel chunk
+    constexpr std::size_t AFFOREST_NEIGHBOR_ROUNDS = 2;
+    constexpr std::size_t AFFOREST_SAMPLES = 1024;
+    constexpr std::size_t AFFOREST_GRAIN = 256;
+    // parallel Boruvka: edges or nodes of a parallel chunk
+    constexpr std::size_t BORUVKA_GRAIN = 2048;
 }
 
 #endif // __CXXGRAPH_CONSTVALUE_H__
\ No newline at end of file
@@ -0,0 +1,119 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_EXECUTIONPOLICY_H__
+#define __CXXGRAPH_EXECUTIONPOLICY_H__
+
+#pragma once
+
+#include <algorithm>
+#include "ThreadPool.hpp"
+
+namespace CXXGRAPH
+{
+	/// Execution context of an algorithm: sequential, parallel with a number of threads of the
+	/// default pool, or parallel on a pool provided by the user.
+	/// The sequential policy runs exactly the code of the overloads without a policy, inline on the
+	/// calling thread and without accessing any pool.
+	/// Only the algorithms of Graph that have a parallel kernel take a policy; the other algorithms
+	/// always run on the calling thread and are called without one.
+	class ExecutionPolicy
+	{
+	private:
+		unsigned int numberOfThreads;
+		ThreadPool *pool;
+
+		ExecutionPolicy(unsigned int numberOfThreads, ThreadPool *pool) : numberOfThreads(numberOfThreads), pool(pool) {}
+
+	public:
+		/// Run the algorithm on the calling thread only
+		static ExecutionPolicy sequential()
+		{
+			return ExecutionPolicy(1, nullptr);
+		}
+		/**
+		 * @brief Run the algorithm on the default pool
+		 *
+		 * @param numberOfThreads number of threads, 0 for the size of the pool
+		 */
+		static ExecutionPolicy parallel(unsigned int numberOfThreads = 0)
+		{
+			return ExecutionPolicy(numberOfThreads, nullptr);
+		}
+		/**
+		 * @brief Run the algorithm on the given pool, that must outlive the calls
+		 *
+		 * @param numberOfThreads number of threads, 0 for the size of the pool
+		 */
+		static ExecutionPolicy on(ThreadPool &pool, unsigned int numberOfThreads = 0)
+		{
+			return ExecutionPolicy(numberOfThreads, &pool);
+		}
+
+		/// Return true if the algorithm runs on the calling thread only
+		bool isSequential() const
+		{
+			return getNumberOfThreads() == 1;
+		}
+		/// Return the number of threads the algorithm is split between
+		unsigned int getNumberOfThreads() const
+		{
+			if (numberOfThreads != 0)
+			{
+				return numberOfThreads;
+			}
+			return std::max(getPool().getNumberOfThreads(), 1u);
+		}
+		/// Return the pool that runs the algorithm
+		ThreadPool &getPool() const
+		{
+			return pool != nullptr ? *pool : ThreadPool::getDefault();
+		}
+
+		/**
+		 * @brief Call fn with the pool of the policy as current pool of the calling thread, so the
+		 * parallel kernels called by fn run on it. A policy with a single thread calls fn directly.
+		 *
+		 * @return the result of fn
+		 */
+		template <typename Function>
+		auto run(Function &&fn) const -> decltype(fn())
+		{
+			if (numberOfThreads == 1)
+			{
+				return fn();
+			}
+			struct Scope
+			{
+				ThreadPool *previous;
+				explicit Scope(ThreadPool &pool) : previous(ThreadPool::scopedPool)
+				{
+					ThreadPool::scopedPool = &pool;
+				}
+				~Scope()
+				{
+					ThreadPool::scopedPool = previous;
+				}
+			} scope(getPool());
+			return fn();
+		}
+	};
+}
+
+#endif // __CXXGRAPH_EXECUTIONPOLICY_H__
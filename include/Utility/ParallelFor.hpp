@@ -0,0 +1,68 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_PARALLELFOR_H__
+#define __CXXGRAPH_PARALLELFOR_H__
+
+#pragma once
+
+#include "ThreadPool.hpp"
+
+namespace CXXGRAPH
+{
+	/**
+	 * @brief Function that split the range [begin, end) in chunks of grainSize elements and run
+	 * fn(chunkBegin, chunkEnd, threadId) on every chunk. The chunks are taken dynamically by
+	 * numberOfThreads threads of the pool, the calling thread is one of them and has threadId 0.
+	 * With a single thread, or a range not bigger than a chunk, fn is called inline.
+	 *
+	 * @param pool pool that runs the chunks
+	 * @param begin first index of the range
+	 * @param end end of the range (excluded)
+	 * @param numberOfThreads number of threads that share the work
+	 * @param grainSize number of indices of every chunk
+	 * @param fn function called with the bounds of a chunk and the id of the thread in [0, numberOfThreads)
+	 */
+	template <typename Function>
+	void parallelFor(ThreadPool &pool, std::size_t begin, std::size_t end, unsigned int numberOfThreads, std::size_t grainSize, Function &&fn)
+	{
+		pool.parallelFor(begin, end, numberOfThreads, grainSize, std::forward<Function>(fn));
+	}
+
+	/**
+	 * @brief Same as above, with the chunks run by the current pool of the calling thread.
+	 * A call with a single participant does not access any pool.
+	 */
+	template <typename Function>
+	void parallelFor(std::size_t begin, std::size_t end, unsigned int numberOfThreads, std::size_t grainSize, Function &&fn)
+	{
+		if (begin >= end)
+		{
+			return;
+		}
+		if (numberOfThreads <= 1 || end - begin <= std::max<std::size_t>(grainSize, 1))
+		{
+			fn(begin, end, 0u);
+			return;
+		}
+		ThreadPool::getCurrent().parallelFor(begin, end, numberOfThreads, grainSize, std::forward<Function>(fn));
+	}
+}
+
+#endif // __CXXGRAPH_PARALLELFOR_H__
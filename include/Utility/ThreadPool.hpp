@@ -0,0 +1,348 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_THREADPOOL_H__
+#define __CXXGRAPH_THREADPOOL_H__
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+namespace CXXGRAPH
+{
+	/// Work-stealing pool of threads shared by the parallel algorithms of the library.
+	/// Every worker has its own deque of tasks: a task submitted by a worker goes to the back of
+	/// its deque and the worker takes its tasks from the back, the most recent first, while an idle
+	/// worker steals from the front of the deques of the others. The tasks submitted from outside
+	/// of the pool are spread over the deques in round robin. A thread that waits for a TaskGroup
+	/// runs the pending tasks in the meantime, so the groups can be nested without deadlocks.
+	/// The algorithms use the current pool: the pool selected by an ExecutionPolicy, else the pool
+	/// of the worker that runs them, else the default pool, sized on the hardware and replaceable
+	/// with setDefault(). The default pool is created by the first parallel work that needs it,
+	/// the sequential calls run inline and never create it.
+	class ThreadPool
+	{
+		friend class ExecutionPolicy;
+		friend class TaskGroup;
+
+	private:
+		struct TaskQueue
+		{
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		std::vector<std::unique_ptr<TaskQueue>> queues = {};
+		std::vector<std::thread> workers = {};
+		std::atomic<std::size_t> queuedTasks{0};
+		std::atomic<std::size_t> nextQueue{0};
+		std::mutex sleepMutex;
+		std::condition_variable wakeUp;
+		bool stopping = false;
+
+		// pool and index of the worker running on this thread
+		inline static thread_local ThreadPool *currentPool = nullptr;
+		inline static thread_local std::size_t currentIndex = 0;
+		// pool selected by an ExecutionPolicy on this thread
+		inline static thread_local ThreadPool *scopedPool = nullptr;
+
+		static std::shared_ptr<ThreadPool> &defaultPool()
+		{
+			static std::shared_ptr<ThreadPool> pool = std::make_shared<ThreadPool>(std::max(std::thread::hardware_concurrency(), 1u));
+			return pool;
+		}
+
+		/// Pool selected by an ExecutionPolicy or running this thread, null if it would be the default pool
+		static ThreadPool *selectedPool()
+		{
+			return scopedPool != nullptr ? scopedPool : currentPool;
+		}
+
+		/// Pop a task from the back of the deque of the worker, or steal one from the front of the others
+		bool tryRun(std::size_t index)
+		{
+			std::function<void()> task;
+			{
+				auto &own = *queues[index];
+				std::lock_guard<std::mutex> lock(own.mutex);
+				if (!own.tasks.empty())
+				{
+					task = std::move(own.tasks.back());
+					own.tasks.pop_back();
+				}
+			}
+			for (std::size_t i = 1; !task && i < queues.size(); ++i)
+			{
+				auto &victim = *queues[(index + i) % queues.size()];
+				std::lock_guard<std::mutex> lock(victim.mutex);
+				if (!victim.tasks.empty())
+				{
+					task = std::move(victim.tasks.front());
+					victim.tasks.pop_front();
+				}
+			}
+			if (!task)
+			{
+				return false;
+			}
+			queuedTasks.fetch_sub(1);
+			task();
+			return true;
+		}
+
+		void workerLoop(std::size_t index)
+		{
+			currentPool = this;
+			currentIndex = index;
+			while (true)
+			{
+				if (tryRun(index))
+				{
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(sleepMutex);
+				wakeUp.wait(lock, [this]()
+							{ return stopping || queuedTasks.load() > 0; });
+				if (stopping && queuedTasks.load() == 0)
+				{
+					return;
+				}
+			}
+		}
+
+	public:
+		/**
+		 * @param numberOfThreads number of worker threads, with 0 the tasks are run only by the
+		 * threads that wait for them
+		 */
+		explicit ThreadPool(unsigned int numberOfThreads)
+		{
+			for (unsigned int i = 0; i < std::max(numberOfThreads, 1u); ++i)
+			{
+				queues.emplace_back(new TaskQueue());
+			}
+			workers.reserve(numberOfThreads);
+			for (unsigned int i = 0; i < numberOfThreads; ++i)
+			{
+				workers.emplace_back(&ThreadPool::workerLoop, this, i);
+			}
+		}
+		ThreadPool(const ThreadPool &) = delete;
+		ThreadPool &operator=(const ThreadPool &) = delete;
+		/// The tasks still queued are run before the workers are joined
+		~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(sleepMutex);
+				stopping = true;
+			}
+			wakeUp.notify_all();
+			for (auto &worker : workers)
+			{
+				worker.join();
+			}
+		}
+
+		/// Return the number of worker threads
+		unsigned int getNumberOfThreads() const
+		{
+			return static_cast<unsigned int>(workers.size());
+		}
+
+		/**
+		 * @brief Queue a task, to the deque of the calling worker or of the next worker in round robin
+		 */
+		void submit(std::function<void()> task)
+		{
+			auto index = currentPool == this ? currentIndex : nextQueue.fetch_add(1) % queues.size();
+			{
+				std::lock_guard<std::mutex> lock(queues[index]->mutex);
+				queues[index]->tasks.push_back(std::move(task));
+			}
+			queuedTasks.fetch_add(1);
+			{
+				// the lock orders the notification after the check of a worker going to sleep
+				std::lock_guard<std::mutex> lock(sleepMutex);
+			}
+			wakeUp.notify_one();
+		}
+
+		/**
+		 * @brief Run one queued task on the calling thread, if there is one
+		 *
+		 * @return true if a task was run
+		 */
+		bool runPendingTask()
+		{
+			return tryRun(currentPool == this ? currentIndex : nextQueue.load() % queues.size());
+		}
+
+		/**
+		 * @brief Split the range [begin, end) in chunks of grainSize elements and run
+		 * fn(chunkBegin, chunkEnd, threadId) on every chunk. The chunks are taken dynamically by
+		 * numberOfThreads participants: the calling thread, with threadId 0, and numberOfThreads - 1
+		 * tasks of the pool, each with its own threadId in [1, numberOfThreads), so fn can keep
+		 * per-thread state indexed by threadId. The call returns when all the chunks are done.
+		 * With a single participant, or a range not bigger than a chunk, fn is called inline.
+		 */
+		template <typename Function>
+		void parallelFor(std::size_t begin, std::size_t end, unsigned int numberOfThreads, std::size_t grainSize, Function &&fn);
+
+		/// Return the pool used by the algorithms of the library
+		static ThreadPool &getDefault()
+		{
+			return *defaultPool();
+		}
+		/**
+		 * @brief Install the pool used by the algorithms of the library, e.g. to size it or to share
+		 * the threads of the application. It must not be called while an algorithm is running.
+		 *
+		 * @return the pool that was installed before, so it can be restored
+		 */
+		static std::shared_ptr<ThreadPool> setDefault(std::shared_ptr<ThreadPool> pool)
+		{
+			return std::exchange(defaultPool(), std::move(pool));
+		}
+		/// Return the pool used by the parallel algorithms called from this thread
+		static ThreadPool &getCurrent()
+		{
+			auto pool = selectedPool();
+			return pool != nullptr ? *pool : getDefault();
+		}
+	};
+
+	/// Group of tasks run by a ThreadPool, that can be waited together.
+	/// The destructor waits for the tasks that are still running.
+	class TaskGroup
+	{
+	private:
+		// resolved to the default pool by the first task, if no pool is selected at the construction
+		ThreadPool *pool;
+		std::size_t pending = 0;
+		std::mutex mutex;
+		std::condition_variable done;
+
+	public:
+		/// Group of the current pool of the calling thread
+		TaskGroup() : pool(ThreadPool::selectedPool()) {}
+		explicit TaskGroup(ThreadPool &pool) : pool(&pool) {}
+		TaskGroup(const TaskGroup &) = delete;
+		TaskGroup &operator=(const TaskGroup &) = delete;
+		~TaskGroup()
+		{
+			wait();
+		}
+
+		/**
+		 * @brief Submit fn to the pool as a task of the group
+		 */
+		template <typename Function>
+		void run(Function &&fn)
+		{
+			if (pool == nullptr)
+			{
+				pool = &ThreadPool::getDefault();
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				++pending;
+			}
+			pool->submit([this, fn = std::forward<Function>(fn)]() mutable
+						{
+							fn();
+							std::lock_guard<std::mutex> lock(mutex);
+							if (--pending == 0)
+							{
+								done.notify_all();
+							} });
+		}
+
+		/**
+		 * @brief Wait for all the tasks of the group, running queued tasks of the pool in the meantime
+		 */
+		void wait()
+		{
+			while (true)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					if (pending == 0)
+					{
+						return;
+					}
+				}
+				if (pool->runPendingTask())
+				{
+					continue;
+				}
+				// the tasks of the group are running on other threads, new tasks are checked periodically
+				std::unique_lock<std::mutex> lock(mutex);
+				done.wait_for(lock, std::chrono::milliseconds(1), [this]()
+							  { return pending == 0; });
+			}
+		}
+	};
+
+	template <typename Function>
+	void ThreadPool::parallelFor(std::size_t begin, std::size_t end, unsigned int numberOfThreads, std::size_t grainSize, Function &&fn)
+	{
+		if (begin >= end)
+		{
+			return;
+		}
+		grainSize = std::max<std::size_t>(grainSize, 1);
+		const auto chunks = (end - begin + grainSize - 1) / grainSize;
+		const auto threads = static_cast<unsigned int>(std::min<std::size_t>(std::max(numberOfThreads, 1u), chunks));
+		if (threads == 1)
+		{
+			fn(begin, end, 0u);
+			return;
+		}
+		std::atomic<std::size_t> nextChunk(0);
+		std::atomic<unsigned int> nextThreadId(1);
+		auto participant = [&](unsigned int threadId)
+		{
+			for (auto chunk = nextChunk.fetch_add(1); chunk < chunks; chunk = nextChunk.fetch_add(1))
+			{
+				auto chunkBegin = begin + chunk * grainSize;
+				fn(chunkBegin, std::min(end, chunkBegin + grainSize), threadId);
+			}
+		};
+		TaskGroup group(*this);
+		for (unsigned int t = 1; t < threads; ++t)
+		{
+			group.run([&]()
+					  { participant(nextThreadId.fetch_add(1)); });
+		}
+		participant(0);
+		group.wait();
+	}
+}
+
+#endif // __CXXGRAPH_THREADPOOL_H__
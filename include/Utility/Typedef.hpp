@@ -24,6 +24,8 @@
 
 #include <map>
 #include <string>
+#include <vector>
+#include <unordered_map>
 #include <fstream>
 
 namespace CXXGRAPH
@@ -52,6 +54,25 @@ namespace CXXGRAPH
 
 	typedef E_InputOutputFormat InputOutputFormat;
 
+	/// Specify the strategy used to select the landmarks of an ALT index
+	enum E_LandmarkSelection
+	{
+		LANDMARK_FARTHEST, ///< every landmark is the node farthest from the landmarks already selected
+		LANDMARK_AVOID	   ///< every landmark is the leaf of the shortest path subtree worst covered by the landmarks already selected
+	};
+
+	typedef E_LandmarkSelection LandmarkSelection;
+
+	/// Specify the algorithm used to compute a shortest path tree
+	enum E_ShortestPathAlgorithm
+	{
+		SP_DIJKSTRA,	 ///< Dijkstra's algorithm, non negative weights
+		SP_DIAL,		 ///< Dial's algorithm, non negative weights truncated to integers
+		SP_BELLMAN_FORD ///< Bellman-Ford's algorithm, detects the negative cycles
+	};
+
+	typedef E_ShortestPathAlgorithm ShortestPathAlgorithm;
+
 	
 
     /////////////////////////////////////////////////////
@@ -114,6 +135,46 @@ namespace CXXGRAPH
 		std::unordered_map<std::pair<std::string, std::string>, double, pair_hash> result = {};
 	};
 	typedef FWResult_struct FWResult;
+
+	/// Struct that contains a dense matrix of shortest distances between a set of row nodes and a set of column nodes
+	template <typename T>
+	struct DistanceMatrixResult_struct
+	{
+		bool success = false;						   // TRUE if the function does not return error, FALSE otherwise
+		bool negativeCycle = false;					   // TRUE if graph contains a negative cycle, FALSE otherwise
+		std::string errorMessage = "";				   //message of error
+		std::vector<const Node<T> *> rowNodes = {};	   // node of every row
+		std::vector<const Node<T> *> columnNodes = {}; // node of every column
+		std::vector<double> distances = {};			   // row-major distances, INF_DOUBLE if the column node is not reachable from the row node
+
+		/// distance from the node of row i to the node of column j
+		double at(std::size_t row, std::size_t column) const
+		{
+			return distances[row * columnNodes.size() + column];
+		}
+		/// the same distances keyed by the user ids of the nodes, as returned by Graph::floydWarshall()
+		FWResult toFWResult() const
+		{
+			FWResult result;
+			result.success = success;
+			result.negativeCycle = negativeCycle;
+			result.errorMessage = errorMessage;
+			if (!success || negativeCycle)
+			{
+				return result;
+			}
+			for (std::size_t row = 0; row < rowNodes.size(); ++row)
+			{
+				for (std::size_t column = 0; column < columnNodes.size(); ++column)
+				{
+					result.result[std::make_pair(rowNodes[row]->getUserId(), columnNodes[column]->getUserId())] = at(row, column);
+				}
+			}
+			return result;
+		}
+	};
+	template <typename T>
+	using DistanceMatrixResult = DistanceMatrixResult_struct<T>;
 	
 	/// Struct that contains the information about Prim, Boruvka & Kruskal Algorithm results
 	struct MstResult_struct
@@ -152,6 +213,19 @@ namespace CXXGRAPH
     };
     template <typename T>
     using TopoSortResult = TopoSortResult_struct<T>;
+
+	/// Struct that contains the nodes in topological order and the level of every node
+	template <typename T>
+	struct TopoLevelResult_struct
+	{
+		bool success = false;								// TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage = "";						// message of error
+		std::vector<const Node<T> *> nodesInTopoOrder = {};	// nodes in topological order, level by level
+		std::vector<std::size_t> level = {};				// length of the longest path that ends in nodesInTopoOrder[i]
+		std::size_t numberOfLevels = 0;						// number of levels, the nodes of a level are independent
+	};
+	template <typename T>
+	using TopoLevelResult = TopoLevelResult_struct<T>;
     
         // typedef for a collection of sets of vertices (useful for connected components algorithms) 
         template <typename T>
@@ -168,6 +242,32 @@ namespace CXXGRAPH
         template <typename T>
         using SCCResult = SCCResult_struct<T>;
 
+	/// Struct that contains the id of the component of every node of the graph
+	template <typename T>
+	struct ComponentLabelResult_struct
+	{
+		bool success = false;						// TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage = "";				// message of error
+		std::vector<const Node<T> *> nodes = {};	// nodes of the graph
+		std::vector<std::size_t> componentId = {};	// component of nodes[i], in [0, numberOfComponents)
+		std::size_t numberOfComponents = 0;			// number of components
+	};
+	template <typename T>
+	using ComponentLabelResult = ComponentLabelResult_struct<T>;
+
+	/// Struct that contains an eulerian path of the graph
+	template <typename T>
+	struct EulerianPathResult_struct
+	{
+		bool success = false;						// TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage = "";				// message of error
+		bool isCircuit = false;						// TRUE if the path ends in its first node
+		std::vector<const Node<T> *> nodes = {};	// nodes of the path, one more than the edges
+		std::vector<const Edge<T> *> edges = {};	// edges of the path, edges[i] goes from nodes[i] to nodes[i + 1]
+	};
+	template <typename T>
+	using EulerianPathResult = EulerianPathResult_struct<T>;
+
 	/// Struct that contains the information about Best First Search Algorithm results
 	template <typename T>
 	struct BestFirstSearchResult_struct
@@ -179,6 +279,48 @@ namespace CXXGRAPH
     template <typename T>
     using BestFirstSearchResult = BestFirstSearchResult_struct<T>;
 
+	/// Struct that contains the breadth first search tree of the nodes reached from the start node
+	template <typename T>
+	struct BFSTreeResult_struct
+	{
+		bool success = false;						// TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage = "";				// message of error
+		std::vector<const Node<T> *> nodes = {};	// reached nodes, in order of depth
+		std::vector<std::size_t> depth = {};		// number of edges from the start node to nodes[i]
+		std::vector<const Node<T> *> parent = {};	// node that discovered nodes[i], nullptr for the start node
+	};
+	template <typename T>
+	using BFSTreeResult = BFSTreeResult_struct<T>;
+
+	/// Struct that contains the number of nodes reached from every source and the sum of their depths
+	template <typename T>
+	struct ReachabilityResult_struct
+	{
+		bool success = false;							  // TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage = "";					  // message of error
+		std::vector<const Node<T> *> sources = {};		  // source of every row
+		std::vector<std::size_t> reachableCount = {};	  // number of nodes reached from sources[i], itself included
+		std::vector<unsigned long long> depthSum = {};	  // sum of the depths of the nodes reached from sources[i]
+
+		/// closeness centrality of sources[i] in its reachable set, (reachable - 1) / depthSum
+		double closeness(std::size_t i) const
+		{
+			return depthSum[i] == 0 ? 0.0 : static_cast<double>(reachableCount[i] - 1) / depthSum[i];
+		}
+	};
+	template <typename T>
+	using ReachabilityResult = ReachabilityResult_struct<T>;
+
+	/// Struct that contains the information about K Shortest Paths Algorithm results
+	struct KShortestPathsResult_struct
+	{
+		bool success = false;									  // TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage = "";							  // message of error
+		std::vector<std::vector<unsigned long long>> paths = {}; // ids of the edges of every path from source to target, in order of cost
+		std::vector<double> costs = {};							  // cost of every path
+	};
+	typedef KShortestPathsResult_struct KShortestPathsResult;
+
 	/// Struct that contains the information about the partitioning statistics
 	
 
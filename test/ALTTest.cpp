@@ -0,0 +1,161 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(ALTTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *> pairNode(&node1, &node2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, pairNode, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt(graph, 2);
+    ASSERT_EQ(alt.build(), 0);
+    ASSERT_TRUE(alt.isBuilt());
+    ASSERT_EQ(alt.getLandmarks().size(), 2);
+    ASSERT_EQ(alt.getMemorySize(), 2 * 2 * 3 * sizeof(double) + 2 * sizeof(std::size_t));
+    auto res = alt.query(node1, node3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.result, 2);
+    res = alt.query(node3, node1);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 6);
+    res = alt.query(node3, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 7);
+    res = alt.query(node2, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 0);
+}
+
+// same distances of dijkstra on a random directed graph, with both the landmark selections
+TEST(ALTTest, test_2)
+{
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> nodeDistribution(0, 99);
+    std::uniform_int_distribution<int> weightDistribution(0, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 100; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 300; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    for (auto selection : {CXXGRAPH::LANDMARK_FARTHEST, CXXGRAPH::LANDMARK_AVOID})
+    {
+        CXXGRAPH::SHORTESTPATH::ALT<int> alt(graph, 8, selection);
+        ASSERT_EQ(alt.build(), 0);
+        ASSERT_EQ(alt.getLandmarks().size(), 8);
+        for (const auto &source : graph.getNodeSet())
+        {
+            for (const auto &target : graph.getNodeSet())
+            {
+                auto expected = graph.dijkstra(*source, *target);
+                auto res = alt.query(*source, *target);
+                ASSERT_EQ(res.success, expected.success);
+                ASSERT_EQ(res.errorMessage, expected.errorMessage);
+                if (expected.success)
+                {
+                    ASSERT_DOUBLE_EQ(res.result, expected.result);
+                    ASSERT_LE(alt.getLastQuerySettledNodes(), graph.getNodeSet().size());
+                }
+            }
+        }
+    }
+}
+
+// errors
+TEST(ALTTest, test_3)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node3, node2, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt(graph);
+    auto res = alt.query(node1, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_ALT_NOT_BUILT);
+    ASSERT_EQ(alt.build(), 0);
+    // no more landmarks than nodes
+    ASSERT_EQ(alt.getLandmarks().size(), 3);
+    res = alt.query(node4, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = alt.query(node1, node4);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    res = alt.query(node1, node3);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node3);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt1(graph1);
+    ASSERT_EQ(alt1.build(), -1);
+    ASSERT_EQ(alt1.getErrorMessage(), CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node3, -1);
+    edgeSet.erase(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph2(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt2(graph2);
+    ASSERT_EQ(alt2.build(), -1);
+    ASSERT_EQ(alt2.getErrorMessage(), CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+}
+
+// a path explores less nodes than the graph, two components get a landmark each
+TEST(ALTTest, test_4)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 60; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i + 1 < 50; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[i], *nodes[i + 1], 1));
+        edgeSet.insert(edges.back().get());
+    }
+    for (int i = 50; i + 1 < 60; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[i], *nodes[i + 1], 1));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ALT<int> alt(graph, 2, CXXGRAPH::LANDMARK_FARTHEST);
+    ASSERT_EQ(alt.build(), 0);
+    auto landmarks = alt.getLandmarks();
+    ASSERT_EQ(landmarks.size(), 2);
+    ASSERT_NE(landmarks[0]->getData() < 50, landmarks[1]->getData() < 50);
+    auto res = alt.query(*nodes[10], *nodes[20]);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 10);
+    ASSERT_LT(alt.getLastQuerySettledNodes(), 50);
+    res = alt.query(*nodes[10], *nodes[55]);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+    ASSERT_EQ(alt.getLastQuerySettledNodes(), 0);
+}
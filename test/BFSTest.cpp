@@ -331,3 +331,52 @@ TEST(BFSTest, test_13)
         }
     }
 }
+
+// the nodes are returned level by level, with sparse and dense frontiers
+TEST(BFSTest, test_14)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 3000; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    // a path of 100 nodes that reaches a tree with fan-out 40
+    for (int i = 0; i + 1 < 100; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(edges.size(), *nodes[i], *nodes[i + 1]));
+        edgeSet.insert(edges.back().get());
+    }
+    for (int i = 100; i < 3000; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(edges.size(), *nodes[99 + (i - 100) / 40], *nodes[i]));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    for (unsigned int threads : {1, 4})
+    {
+        auto res = graph.concurrency_breadth_first_search(*nodes[0], threads);
+        ASSERT_EQ(res.size(), 3000);
+        std::unordered_map<int, int> depth;
+        depth[0] = 0;
+        for (int i = 1; i < 100; ++i)
+        {
+            depth[i] = i;
+        }
+        for (int i = 100; i < 3000; ++i)
+        {
+            depth[i] = depth[99 + (i - 100) / 40] + 1;
+        }
+        std::set<int> reached;
+        for (std::size_t i = 0; i < res.size(); ++i)
+        {
+            reached.insert(res[i].getData());
+            if (i > 0)
+            {
+                ASSERT_LE(depth[res[i - 1].getData()], depth[res[i].getData()]);
+            }
+        }
+        ASSERT_EQ(reached.size(), 3000);
+    }
+}
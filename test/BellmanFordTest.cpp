@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -151,3 +152,94 @@ TEST(BellmanFordTest, test_5)
 
 }
 
+
+// negative weights without negative cycles, sequential and parallel rounds
+TEST(BellmanFordTest, test_6)
+{
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> nodeDistribution(0, 199);
+    std::uniform_int_distribution<int> weightDistribution(0, 30);
+    std::uniform_int_distribution<int> potentialDistribution(0, 50);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<int> potential;
+    for (int i = 0; i < 200; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+        potential.push_back(potentialDistribution(generator));
+    }
+    // w'(u, v) = w(u, v) + p(u) - p(v) has the same shortest paths of w, and d'(s, t) = d(s, t) + p(s) - p(t)
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges, reweightedEdges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet, reweightedEdgeSet;
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto from = nodeDistribution(generator);
+        auto to = nodeDistribution(generator);
+        auto weight = weightDistribution(generator);
+        edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weight));
+        edgeSet.insert(edges.back().get());
+        reweightedEdges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weight + potential[from] - potential[to]));
+        reweightedEdgeSet.insert(reweightedEdges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::Graph<int> reweightedGraph(reweightedEdgeSet);
+    for (int source = 0; source < 200; source += 17)
+    {
+        for (int target = 0; target < 200; target += 7)
+        {
+            auto expected = graph.dijkstra(*nodes[source], *nodes[target]);
+            auto res = reweightedGraph.bellmanford(*nodes[source], *nodes[target]);
+            auto parallelRes = reweightedGraph.bellmanford(*nodes[source], *nodes[target], 4);
+            ASSERT_EQ(res.success, expected.success);
+            ASSERT_FALSE(res.negativeCycle);
+            ASSERT_EQ(res.errorMessage, expected.errorMessage);
+            ASSERT_EQ(parallelRes.success, res.success);
+            ASSERT_FALSE(parallelRes.negativeCycle);
+            ASSERT_EQ(parallelRes.result, res.result);
+            if (expected.success)
+            {
+                ASSERT_EQ(res.result, expected.result + potential[source] - potential[target]);
+            }
+        }
+    }
+}
+
+// negative cycle found by the parallel rounds, the undirected negative edges are a negative cycle
+TEST(BellmanFordTest, test_7)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 50; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 50; ++i)
+    {
+        for (int j = 0; j < 50; ++j)
+        {
+            if (i != j)
+            {
+                edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i * 50 + j, *nodes[i], *nodes[j], (j == (i + 1) % 50) ? -1 : 100));
+                edgeSet.insert(edges.back().get());
+            }
+        }
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.bellmanford(*nodes[0], *nodes[10], 4);
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.negativeCycle);
+    ASSERT_EQ(res.errorMessage, "");
+    res = graph.bellmanford(*nodes[0], *nodes[10]);
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.negativeCycle);
+
+    CXXGRAPH::T_EdgeSet<int> undirectedEdgeSet;
+    CXXGRAPH::UndirectedWeightedEdge<int> edge1(1, *nodes[0], *nodes[1], 3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, *nodes[1], *nodes[2], -1);
+    undirectedEdgeSet.insert(&edge1);
+    undirectedEdgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> undirectedGraph(undirectedEdgeSet);
+    res = undirectedGraph.bellmanford(*nodes[0], *nodes[2]);
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.negativeCycle);
+}
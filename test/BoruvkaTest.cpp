@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -179,4 +180,71 @@ TEST(BoruvkaTest, test_4)
     ASSERT_FALSE(res.success);
     ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
 
-}
\ No newline at end of file
+}
+
+// same cost of kruskal on a random graph with repeated weights, the same forest for any number of threads
+TEST(BoruvkaTest, test_5)
+{
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> nodeDistribution(0, 1999);
+    std::uniform_int_distribution<int> weightDistribution(1, 10);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 2000; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 1; i < 2000; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator) % i], *nodes[i], weightDistribution(generator)));
+        edgeSet.insert(edges.back().get());
+    }
+    for (int i = 2000; i < 20000; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto expected = graph.kruskal();
+    auto res = graph.boruvka();
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.mst.size(), graph.getNodeSet().size() - 1);
+    ASSERT_EQ(res.mstCost, expected.mstCost);
+    for (unsigned int threads : {2, 4, 8})
+    {
+        auto parallel = graph.boruvka(threads);
+        ASSERT_TRUE(parallel.success);
+        ASSERT_EQ(parallel.mst, res.mst);
+        ASSERT_EQ(parallel.mstCost, res.mstCost);
+    }
+    auto policy = graph.boruvka(CXXGRAPH::ExecutionPolicy::parallel(4));
+    ASSERT_EQ(policy.mst, res.mst);
+}
+
+// minimum spanning forest of a graph that is not connected
+TEST(BoruvkaTest, test_6)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::Node<int> node5("5", 5);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge1(1, node1, node2, 3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge4(4, node4, node5, 5);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge5(5, node4, node4, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    edgeSet.insert(&edge5);
+
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::MstResult res = graph.boruvka(2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.mst.size(), 3);
+    ASSERT_EQ(res.mstCost, 8);
+}
@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -430,4 +431,129 @@ TEST(ConnectivityTest, test_8)
     CXXGRAPH::Graph<int> graph(edgeSet);
 
     ASSERT_FALSE(graph.isStronglyConnectedGraph());
-}
\ No newline at end of file
+}
+
+// component labels of random graphs, the edges of directed graphs are weakly connected
+TEST(ConnectivityTest, test_9)
+{
+    std::mt19937 generator(11);
+    for (bool directed : {false, true})
+    {
+        for (int numberOfNodes : {40, 3000})
+        {
+            std::uniform_int_distribution<int> nodeDistribution(0, numberOfNodes - 1);
+            std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+            for (int i = 0; i < numberOfNodes; ++i)
+            {
+                nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+            }
+            std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+            CXXGRAPH::T_EdgeSet<int> edgeSet;
+            for (int i = 0; i < numberOfNodes * 9 / 10; ++i)
+            {
+                auto &from = *nodes[nodeDistribution(generator)];
+                auto &to = *nodes[nodeDistribution(generator)];
+                if (directed)
+                {
+                    edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, from, to));
+                }
+                else
+                {
+                    edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(i, from, to));
+                }
+                edgeSet.insert(edges.back().get());
+            }
+            CXXGRAPH::Graph<int> graph(edgeSet);
+
+            // reference components with a sequential union-find
+            std::unordered_map<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *> parent;
+            std::function<const CXXGRAPH::Node<int> *(const CXXGRAPH::Node<int> *)> find = [&](const CXXGRAPH::Node<int> *node)
+            {
+                if (parent.count(node) == 0 || parent[node] == node)
+                {
+                    return parent[node] = node;
+                }
+                return parent[node] = find(parent[node]);
+            };
+            for (const auto &edge : edges)
+            {
+                parent[find(edge->getNodePair().first)] = find(edge->getNodePair().second);
+            }
+            std::set<const CXXGRAPH::Node<int> *> roots;
+            for (const auto &node : graph.getNodeSet())
+            {
+                roots.insert(find(node));
+            }
+
+            for (unsigned int threads : {1u, 4u})
+            {
+                auto res = graph.connectedComponents(threads);
+                ASSERT_TRUE(res.success);
+                ASSERT_EQ(res.nodes.size(), res.componentId.size());
+                std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> label;
+                std::size_t firstOfNext = 0;
+                for (std::size_t i = 0; i < res.nodes.size(); ++i)
+                {
+                    // numbered in order of the first node
+                    ASSERT_LE(res.componentId[i], firstOfNext);
+                    if (res.componentId[i] == firstOfNext)
+                    {
+                        ++firstOfNext;
+                    }
+                    auto root = find(res.nodes[i]);
+                    if (label.count(root) == 0)
+                    {
+                        label[root] = res.componentId[i];
+                    }
+                    ASSERT_EQ(label[root], res.componentId[i]);
+                }
+                ASSERT_EQ(roots.size(), res.numberOfComponents);
+                ASSERT_EQ(firstOfNext, res.numberOfComponents);
+            }
+            ASSERT_EQ(graph.isConnectedGraph(), !directed && roots.size() == 1);
+        }
+    }
+}
+
+// a long path is one component, weakly connected if directed
+TEST(ConnectivityTest, test_10)
+{
+    const int n = 100000;
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < n; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedEdge<int>>> undirectedEdges;
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> directedEdges;
+    CXXGRAPH::T_EdgeSet<int> undirectedEdgeSet;
+    CXXGRAPH::T_EdgeSet<int> directedEdgeSet;
+    for (int i = 0; i + 1 < n; ++i)
+    {
+        undirectedEdges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(i, *nodes[i], *nodes[i + 1]));
+        undirectedEdgeSet.insert(undirectedEdges.back().get());
+        // alternate directions, so the path is not strongly connected
+        if (i % 2 == 0)
+        {
+            directedEdges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[i], *nodes[i + 1]));
+        }
+        else
+        {
+            directedEdges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[i + 1], *nodes[i]));
+        }
+        directedEdgeSet.insert(directedEdges.back().get());
+    }
+    CXXGRAPH::Graph<int> undirected(undirectedEdgeSet);
+    ASSERT_TRUE(undirected.isConnectedGraph());
+    ASSERT_EQ(undirected.connectedComponents(4).numberOfComponents, 1);
+    CXXGRAPH::Graph<int> directed(directedEdgeSet);
+    ASSERT_FALSE(directed.isConnectedGraph());
+    auto res = directed.connectedComponents(4);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.numberOfComponents, 1);
+    ASSERT_EQ(res.componentId, std::vector<std::size_t>(n, 0));
+
+    CXXGRAPH::Graph<int> empty;
+    ASSERT_TRUE(empty.isConnectedGraph());
+    ASSERT_EQ(empty.connectedComponents().numberOfComponents, 0);
+}
@@ -0,0 +1,229 @@
+#include <cstring>
+#include <fstream>
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(ContractionHierarchyTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *> pairNode(&node1, &node2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, pairNode, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    ASSERT_EQ(ch.build(), 0);
+    ASSERT_TRUE(ch.isBuilt());
+    auto res = ch.query(node1, node3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.result, 2);
+    res = ch.query(node3, node1);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 6);
+    res = ch.query(node3, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 7);
+    res = ch.query(node2, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 0);
+}
+
+// same distances of dijkstra on a random directed graph
+TEST(ContractionHierarchyTest, test_2)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 59);
+    std::uniform_int_distribution<int> weightDistribution(1, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 60; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 240; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    ASSERT_EQ(ch.build(), 0);
+    for (const auto &source : graph.getNodeSet())
+    {
+        for (const auto &target : graph.getNodeSet())
+        {
+            auto expected = graph.dijkstra(*source, *target);
+            auto res = ch.query(*source, *target);
+            ASSERT_EQ(res.success, expected.success);
+            ASSERT_EQ(res.errorMessage, expected.errorMessage);
+            if (expected.success)
+            {
+                ASSERT_DOUBLE_EQ(res.result, expected.result);
+            }
+        }
+    }
+}
+
+// errors
+TEST(ContractionHierarchyTest, test_3)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node3, node2, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    auto res = ch.query(node1, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_CH_NOT_BUILT);
+    ASSERT_EQ(ch.build(), 0);
+    res = ch.query(node4, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = ch.query(node1, node4);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    res = ch.query(node1, node3);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node3);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch1(graph1);
+    ASSERT_EQ(ch1.build(), -1);
+    ASSERT_EQ(ch1.getErrorMessage(), CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node3, -1);
+    edgeSet.erase(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph2(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch2(graph2);
+    ASSERT_EQ(ch2.build(), -1);
+    ASSERT_EQ(ch2.getErrorMessage(), CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+}
+
+// write and read the hierarchy
+TEST(ContractionHierarchyTest, test_4)
+{
+    CXXGRAPH::Node<int> nodeA("A", 1);
+    CXXGRAPH::Node<int> nodeB("B", 1);
+    CXXGRAPH::Node<int> nodeC("C", 1);
+    CXXGRAPH::Node<int> nodeD("D", 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge1(1, nodeA, nodeB, 3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, nodeA, nodeC, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, nodeB, nodeC, 7);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge4(4, nodeC, nodeD, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    ASSERT_EQ(ch.build(), 0);
+    ASSERT_EQ(ch.writeToFile(".", "ch_test"), 0);
+
+    // a new graph with the same nodes
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch1(graph1);
+    ASSERT_EQ(ch1.readFromFile(".", "ch_test"), 0);
+    ASSERT_TRUE(ch1.isBuilt());
+    ASSERT_EQ(ch1.getNumberOfShortcuts(), ch.getNumberOfShortcuts());
+    ASSERT_EQ(ch1.getRank(nodeD), ch.getRank(nodeD));
+    auto res = ch1.query(nodeB, nodeD);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 6);
+    res = ch1.query(nodeD, nodeB);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 6);
+
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch2(graph1);
+    ASSERT_EQ(ch2.readFromFile(".", "not_existing_ch"), -1);
+    ASSERT_FALSE(ch2.isBuilt());
+}
+
+// a corrupted or truncated file is rejected instead of read out of bounds
+TEST(ContractionHierarchyTest, test_5)
+{
+    CXXGRAPH::Node<int> nodeA("A", 1);
+    CXXGRAPH::Node<int> nodeB("B", 1);
+    CXXGRAPH::Node<int> nodeC("C", 1);
+    CXXGRAPH::Node<int> nodeD("D", 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge1(1, nodeA, nodeB, 3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, nodeA, nodeC, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, nodeB, nodeC, 7);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge4(4, nodeC, nodeD, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    ASSERT_EQ(ch.build(), 0);
+    ASSERT_EQ(ch.writeToFile(".", "ch_corrupt_test"), 0);
+
+    std::ifstream ifs("./ch_corrupt_test.ch", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+    // walk to the first element of the upward target array
+    auto readWord = [&content](std::size_t position)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, content.data() + position, sizeof(word));
+        return word;
+    };
+    std::size_t position = sizeof(CXXGRAPH::CH_FILE_MAGIC);
+    auto n = readWord(position);
+    position += 2 * sizeof(uint64_t);
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        position += sizeof(uint64_t) + readWord(position);
+    }
+    // rank and upward offsets
+    for (int i = 0; i < 2; ++i)
+    {
+        position += sizeof(uint64_t) + readWord(position) * sizeof(uint64_t);
+    }
+    ASSERT_GT(readWord(position), 0u);
+    position += sizeof(uint64_t);
+
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch1(graph);
+    std::string corrupted = content;
+    uint64_t outOfRange = n + 100;
+    std::memcpy(&corrupted[position], &outOfRange, sizeof(outOfRange));
+    std::ofstream("./ch_corrupt_test.ch", std::ios::binary) << corrupted;
+    ASSERT_EQ(ch1.readFromFile(".", "ch_corrupt_test"), -1);
+    ASSERT_FALSE(ch1.isBuilt());
+
+    // offsets past the end of the arc array
+    corrupted = content;
+    uint64_t offset = 1000;
+    std::memcpy(&corrupted[position - 2 * sizeof(uint64_t)], &offset, sizeof(offset));
+    std::ofstream("./ch_corrupt_test.ch", std::ios::binary) << corrupted;
+    ASSERT_EQ(ch1.readFromFile(".", "ch_corrupt_test"), -1);
+
+    // truncated file
+    std::ofstream("./ch_corrupt_test.ch", std::ios::binary) << content.substr(0, content.size() - 5);
+    ASSERT_EQ(ch1.readFromFile(".", "ch_corrupt_test"), -1);
+    ASSERT_FALSE(ch1.isBuilt());
+
+    std::ofstream("./ch_corrupt_test.ch", std::ios::binary) << content;
+    ASSERT_EQ(ch1.readFromFile(".", "ch_corrupt_test"), 0);
+    ASSERT_EQ(ch1.query(nodeB, nodeD).result, 6);
+}
@@ -127,4 +127,96 @@ TEST(DFSTest, test_6)
     ASSERT_FALSE(std::find(res.begin(), res.end(), node2) != res.end());
     ASSERT_FALSE(std::find(res.begin(), res.end(), node3) != res.end());
     ASSERT_FALSE(std::find(res.begin(), res.end(), node4) != res.end());
-}
\ No newline at end of file
+}
+
+// pre-order and post-order of the engine, in the order of the adjacency
+TEST(DFSTest, test_7)
+{
+    // 0 -> 1, 0 -> 2, 1 -> 3, 2 -> 3, 3 -> 0, 4 -> 2
+    std::vector<std::size_t> offset = {0, 2, 3, 4, 5, 6};
+    std::vector<std::size_t> adjacency = {1, 2, 3, 3, 0, 2};
+    CXXGRAPH::TRAVERSAL::DepthFirstSearch dfs(offset, adjacency);
+    std::vector<std::size_t> pre, post;
+    std::vector<std::pair<std::size_t, std::size_t>> nonTree;
+    dfs.run(
+        0, [&pre](std::size_t v)
+        { pre.push_back(v); },
+        [&post](std::size_t v)
+        { post.push_back(v); },
+        [&nonTree](std::size_t u, std::size_t v)
+        { nonTree.emplace_back(u, v); });
+    ASSERT_EQ(pre, std::vector<std::size_t>({0, 1, 3, 2}));
+    ASSERT_EQ(post, std::vector<std::size_t>({3, 1, 2, 0}));
+    std::vector<std::pair<std::size_t, std::size_t>> expectedNonTree = {{3, 0}, {2, 3}};
+    ASSERT_EQ(nonTree, expectedNonTree);
+    ASSERT_FALSE(dfs.isVisited(4));
+
+    // the visited set is kept between the searches
+    pre.clear();
+    dfs.run(4, [&pre](std::size_t v)
+            { pre.push_back(v); });
+    ASSERT_EQ(pre, std::vector<std::size_t>({4}));
+    dfs.reset();
+    pre.clear();
+    dfs.run(4, [&pre](std::size_t v)
+            { pre.push_back(v); });
+    ASSERT_EQ(pre, std::vector<std::size_t>({4, 2, 3, 0, 1}));
+}
+
+// a chain of 10M nodes does not overflow the stack
+TEST(DFSTest, test_8)
+{
+    const std::size_t n = 10000000;
+    std::vector<std::size_t> offset(n + 1);
+    std::vector<std::size_t> adjacency(n - 1);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        offset[i] = std::min(i, n - 1);
+        if (i + 1 < n)
+        {
+            adjacency[i] = i + 1;
+        }
+    }
+    offset[n] = n - 1;
+    CXXGRAPH::TRAVERSAL::DepthFirstSearch dfs(offset, adjacency);
+    std::size_t reached = 0, lastPost = n;
+    dfs.run(
+        0, [&reached](std::size_t)
+        { ++reached; },
+        [&lastPost](std::size_t v)
+        { lastPost = v; });
+    ASSERT_EQ(reached, n);
+    ASSERT_EQ(lastPost, 0);
+}
+
+// deep graphs through the Graph interface
+TEST(DFSTest, test_9)
+{
+    const int n = 200000;
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < n; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> directedSet, undirectedSet;
+    for (int i = 0; i + 1 < n; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[i], *nodes[i + 1]));
+        directedSet.insert(edges.back().get());
+        edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(n + i, *nodes[i], *nodes[i + 1]));
+        undirectedSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> directed(directedSet);
+    auto res = directed.depth_first_search(*nodes[0]);
+    ASSERT_EQ(res.size(), n);
+    ASSERT_EQ(res.back(), *nodes[n - 1]);
+    ASSERT_FALSE(directed.isCyclicDirectedGraphDFS());
+    ASSERT_FALSE(directed.isStronglyConnectedGraph());
+    auto scc = directed.kosaraju();
+    ASSERT_TRUE(scc.success);
+    ASSERT_EQ(scc.stronglyConnectedComps.size(), n);
+
+    CXXGRAPH::Graph<int> undirected(undirectedSet);
+    ASSERT_TRUE(undirected.isConnectedGraph());
+}
@@ -0,0 +1,21 @@
+#ifndef __DEFAULTPOOLGUARD_H__
+#define __DEFAULTPOOLGUARD_H__
+#include "CXXGraph.hpp"
+
+// install a default pool for the scope of a test and restore the previous one, also when an assertion fails
+class DefaultPoolGuard
+{
+private:
+    std::shared_ptr<CXXGRAPH::ThreadPool> previous;
+
+public:
+    explicit DefaultPoolGuard(std::shared_ptr<CXXGRAPH::ThreadPool> pool) : previous(CXXGRAPH::ThreadPool::setDefault(std::move(pool))) {}
+    DefaultPoolGuard(const DefaultPoolGuard &) = delete;
+    DefaultPoolGuard &operator=(const DefaultPoolGuard &) = delete;
+    ~DefaultPoolGuard()
+    {
+        CXXGRAPH::ThreadPool::setDefault(std::move(previous));
+    }
+};
+
+#endif // __DEFAULTPOOLGUARD_H__
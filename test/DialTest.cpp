@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -101,4 +102,52 @@ TEST(DialTest, test_5)
     ASSERT_FALSE(res.success);
     ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
     ASSERT_TRUE(res.minDistanceMap.empty());
-}
\ No newline at end of file
+}
+
+// same distances of dijkstra on a random graph, with edges heavier than maxWeight
+TEST(DialTest, test_6)
+{
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> nodeDistribution(0, 299);
+    std::uniform_int_distribution<int> weightDistribution(0, 9);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 300; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 1200; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::DirectedWeightedEdge<int> heavyEdge(1200, *nodes[0], *nodes[299], 25);
+    edgeSet.insert(&heavyEdge);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    for (int source = 0; source < 300; source += 50)
+    {
+        auto res = graph.dial(*nodes[source], 9);
+        ASSERT_TRUE(res.success);
+        ASSERT_EQ(res.minDistanceMap.size(), graph.getNodeSet().size());
+        for (const auto &target : graph.getNodeSet())
+        {
+            auto expected = graph.dijkstra(*nodes[source], *target);
+            if (expected.success)
+            {
+                ASSERT_EQ(res.minDistanceMap.at(target->getId()), expected.result);
+            }
+            else
+            {
+                ASSERT_EQ(res.minDistanceMap.at(target->getId()), std::numeric_limits<long>::max());
+            }
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include <random>
+#include <queue>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+// depth of every node reached from start, with a plain breadth first search
+static std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> referenceDepth(const CXXGRAPH::Graph<int> &graph, const CXXGRAPH::Node<int> *start)
+{
+    std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> depth;
+    auto adj = graph.getAdjMatrix();
+    std::queue<const CXXGRAPH::Node<int> *> tracker;
+    depth[start] = 0;
+    tracker.push(start);
+    while (!tracker.empty())
+    {
+        auto node = tracker.front();
+        tracker.pop();
+        if (adj.count(node))
+        {
+            for (const auto &elem : adj.at(node))
+            {
+                if (!depth.count(elem.first))
+                {
+                    depth[elem.first] = depth[node] + 1;
+                    tracker.push(elem.first);
+                }
+            }
+        }
+    }
+    return depth;
+}
+
+static void checkTree(const CXXGRAPH::Graph<int> &graph, const CXXGRAPH::Node<int> *start, const CXXGRAPH::BFSTreeResult<int> &res)
+{
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    auto expected = referenceDepth(graph, start);
+    ASSERT_EQ(res.nodes.size(), expected.size());
+    ASSERT_EQ(res.nodes.front(), start);
+    ASSERT_EQ(res.parent.front(), nullptr);
+    auto adj = graph.getAdjMatrix();
+    for (std::size_t i = 0; i < res.nodes.size(); ++i)
+    {
+        ASSERT_EQ(res.depth[i], expected.at(res.nodes[i]));
+        if (i > 0)
+        {
+            ASSERT_LE(res.depth[i - 1], res.depth[i]);
+            // the parent is a neighbour in the previous level
+            auto parent = res.parent[i];
+            ASSERT_NE(parent, nullptr);
+            ASSERT_EQ(expected.at(parent) + 1, res.depth[i]);
+            const auto &neighbours = adj.at(parent);
+            ASSERT_TRUE(std::any_of(neighbours.begin(), neighbours.end(), [&](const auto &elem)
+                                    { return elem.first == res.nodes[i]; }));
+        }
+    }
+}
+
+TEST(DirectionOptimizingBFSTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::DirectedEdge<int> edge4(4, node4, node1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.direction_optimizing_breadth_first_search(node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.nodes, std::vector<const CXXGRAPH::Node<int> *>({&node2, &node3, &node1}));
+    ASSERT_EQ(res.depth, std::vector<std::size_t>({0, 1, 2}));
+    ASSERT_EQ(res.parent, std::vector<const CXXGRAPH::Node<int> *>({nullptr, &node2, &node3}));
+
+    CXXGRAPH::Node<int> node5("5", 5);
+    res = graph.direction_optimizing_breadth_first_search(node5);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    ASSERT_TRUE(res.nodes.empty());
+}
+
+// low diameter random graphs, that are expanded bottom-up in the middle levels
+TEST(DirectionOptimizingBFSTest, test_2)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 1999);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 2000; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 16000; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)]));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)]));
+        }
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    for (int start : {0, 7, 1999})
+    {
+        checkTree(graph, nodes[start].get(), graph.direction_optimizing_breadth_first_search(*nodes[start]));
+        checkTree(graph, nodes[start].get(), graph.direction_optimizing_breadth_first_search(*nodes[start], 4));
+    }
+}
+
+// long path with a dense cluster in the middle, the search switches to bottom-up and back
+TEST(DirectionOptimizingBFSTest, test_3)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 600; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    unsigned long long id = 0;
+    for (int i = 0; i + 1 < 600; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(id++, *nodes[i], *nodes[i + 1]));
+        edgeSet.insert(edges.back().get());
+    }
+    for (int i = 100; i < 400; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(id++, *nodes[100], *nodes[i]));
+        edgeSet.insert(edges.back().get());
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(id++, *nodes[i], *nodes[(i * 7) % 300 + 100]));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    checkTree(graph, nodes[0].get(), graph.direction_optimizing_breadth_first_search(*nodes[0]));
+    checkTree(graph, nodes[0].get(), graph.direction_optimizing_breadth_first_search(*nodes[0], 3));
+    checkTree(graph, nodes[250].get(), graph.direction_optimizing_breadth_first_search(*nodes[250], 2));
+}
@@ -0,0 +1,209 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(DynamicShortestPathTreeTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node3, node4, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node3, 5);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::DynamicShortestPathTree<int> tree(graph, node1);
+    ASSERT_TRUE(tree.isValid());
+    ASSERT_EQ(tree.getNumberOfUpdates(), 0);
+    ASSERT_EQ(tree.getDistance(node1), 0);
+    ASSERT_EQ(tree.getDistance(node4), 3);
+
+    // a longer edge does not change the tree
+    graph.addEdge(&edge4);
+    ASSERT_EQ(tree.getNumberOfUpdates(), 1);
+    ASSERT_EQ(tree.getLastRepairedNodes(), 0);
+    ASSERT_EQ(tree.getDistance(node3), 2);
+
+    // a weight decrease repairs only the nodes after the edge
+    graph.setEdgeWeight(edge4, 1);
+    ASSERT_EQ(tree.getNumberOfUpdates(), 2);
+    ASSERT_EQ(tree.getLastRepairedNodes(), 2);
+    ASSERT_EQ(tree.getDistance(node2), 1);
+    ASSERT_EQ(tree.getDistance(node3), 1);
+    ASSERT_EQ(tree.getDistance(node4), 2);
+    ASSERT_EQ(tree.getPath(node4), std::vector<const CXXGRAPH::Edge<int> *>({&edge4, &edge3}));
+
+    // a weight increase of a tree edge repairs its subtree
+    graph.setEdgeWeight(edge4, 3);
+    ASSERT_EQ(tree.getLastRepairedNodes(), 2);
+    ASSERT_EQ(tree.getDistance(node3), 2);
+    ASSERT_EQ(tree.getDistance(node4), 3);
+
+    // the removal of an edge out of the tree repairs nothing
+    graph.removeEdge(4);
+    ASSERT_EQ(tree.getLastRepairedNodes(), 0);
+    ASSERT_EQ(tree.getDistance(node4), 3);
+
+    graph.removeEdge(2);
+    ASSERT_EQ(tree.getLastRepairedNodes(), 2);
+    ASSERT_EQ(tree.getDistance(node3), CXXGRAPH::INF_DOUBLE);
+    ASSERT_EQ(tree.getDistance(node4), CXXGRAPH::INF_DOUBLE);
+    ASSERT_TRUE(tree.getPath(node4).empty());
+    ASSERT_EQ(tree.getTotalRepairedNodes(), 6);
+    ASSERT_EQ(graph.dijkstra(node1, node4).errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+}
+
+// errors and replacement of the edge set
+TEST(DynamicShortestPathTreeTest, test_2)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge1(1, node1, node2, 2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, node2, node3, 2);
+    CXXGRAPH::UndirectedEdge<int> edge3(3, node1, node3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge4(4, node1, node3, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    {
+        CXXGRAPH::SHORTESTPATH::DynamicShortestPathTree<int> tree(graph, node3);
+        ASSERT_EQ(tree.getDistance(node1), 4);
+
+        graph.addEdge(&edge3);
+        ASSERT_FALSE(tree.isValid());
+        ASSERT_EQ(tree.getErrorMessage(), CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+        ASSERT_EQ(tree.getDistance(node1), CXXGRAPH::INF_DOUBLE);
+        graph.setEdgeWeight(edge1, -1);
+        ASSERT_EQ(tree.getErrorMessage(), CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+        graph.removeEdge(3);
+        ASSERT_EQ(tree.getErrorMessage(), CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+        graph.setEdgeWeight(edge1, 1);
+        ASSERT_TRUE(tree.isValid());
+        ASSERT_EQ(tree.getErrorMessage(), "");
+        ASSERT_EQ(tree.getDistance(node1), 3);
+
+        CXXGRAPH::T_EdgeSet<int> edgeSet1;
+        edgeSet1.insert(&edge4);
+        graph.setEdgeSet(edgeSet1);
+        ASSERT_EQ(tree.getDistance(node1), 1);
+        ASSERT_EQ(tree.getDistance(node2), CXXGRAPH::INF_DOUBLE);
+        ASSERT_EQ(tree.getNumberOfUpdates(), 5);
+
+        // the copies of the graph are not observed
+        CXXGRAPH::Graph<int> copy(graph);
+        copy.removeEdge(4);
+        ASSERT_EQ(tree.getDistance(node1), 1);
+        ASSERT_EQ(tree.getNumberOfUpdates(), 5);
+    }
+    // the tree is detached when destroyed
+    graph.removeEdge(4);
+}
+
+// same distances of dijkstra after random updates
+TEST(DynamicShortestPathTreeTest, test_3)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 39);
+    std::uniform_int_distribution<int> weightDistribution(0, 20);
+    std::uniform_int_distribution<int> operationDistribution(0, 3);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 40; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    auto newEdge = [&]()
+    {
+        auto id = edges.size();
+        if (id % 3 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(id, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(id, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        return edges.back().get();
+    };
+    CXXGRAPH::Graph<int> graph;
+    std::vector<unsigned long long> inGraph;
+    for (int i = 0; i < 80; ++i)
+    {
+        graph.addEdge(newEdge());
+        inGraph.push_back(i);
+    }
+    CXXGRAPH::SHORTESTPATH::DynamicShortestPathTree<int> tree(graph, *nodes[0]);
+    for (int update = 0; update < 400; ++update)
+    {
+        auto operation = operationDistribution(generator);
+        if (operation == 0 || inGraph.empty())
+        {
+            graph.addEdge(newEdge());
+            inGraph.push_back(edges.size() - 1);
+        }
+        else
+        {
+            auto position = std::uniform_int_distribution<std::size_t>(0, inGraph.size() - 1)(generator);
+            if (operation == 1)
+            {
+                graph.removeEdge(inGraph[position]);
+                inGraph.erase(inGraph.begin() + position);
+            }
+            else
+            {
+                graph.setEdgeWeight(*edges[inGraph[position]], weightDistribution(generator));
+            }
+        }
+        ASSERT_TRUE(tree.isValid());
+        ASSERT_LE(tree.getLastRepairedNodes(), nodes.size());
+        for (const auto &node : graph.getNodeSet())
+        {
+            auto expected = graph.dijkstra(*nodes[0], *node);
+            ASSERT_EQ(tree.getDistance(*node), expected.success ? expected.result : CXXGRAPH::INF_DOUBLE);
+            double length = 0;
+            for (const auto &edge : tree.getPath(*node))
+            {
+                length += dynamic_cast<const CXXGRAPH::Weighted *>(edge)->getWeight();
+            }
+            if (expected.success)
+            {
+                ASSERT_EQ(length, expected.result);
+            }
+        }
+    }
+    ASSERT_EQ(tree.getNumberOfUpdates(), 400);
+}
+
+// edges out of the graph are not modified, the graph can be destroyed before the tree
+TEST(DynamicShortestPathTreeTest, test_4)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node1, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    auto graph = std::make_unique<CXXGRAPH::Graph<int>>(edgeSet);
+    CXXGRAPH::SHORTESTPATH::DynamicShortestPathTree<int> tree(*graph, node1);
+    auto version = graph->getVersion();
+    graph->setEdgeWeight(edge2, 5);
+    ASSERT_EQ(edge2.getWeight(), 2);
+    ASSERT_EQ(graph->getVersion(), version);
+    ASSERT_EQ(tree.getNumberOfUpdates(), 0);
+
+    graph->setEdgeWeight(edge1, 3);
+    ASSERT_EQ(edge1.getWeight(), 3);
+    ASSERT_EQ(graph->getVersion(), version + 1);
+    ASSERT_EQ(tree.getDistance(node2), 3);
+
+    graph.reset();
+    ASSERT_EQ(tree.getDistance(node2), 3);
+    ASSERT_EQ(tree.getNumberOfUpdates(), 1);
+}
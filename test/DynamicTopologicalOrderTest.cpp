@@ -0,0 +1,185 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+// every edge of the graph goes forward in the order
+static void checkOrder(const CXXGRAPH::Graph<int> &graph, const CXXGRAPH::TRAVERSAL::DynamicTopologicalOrder<int> &order)
+{
+    ASSERT_EQ(order.getOrder().size(), graph.getNodeSet().size());
+    for (const auto &edge : graph.getEdgeSet())
+    {
+        ASSERT_TRUE(order.isBefore(*edge->getNodePair().first, *edge->getNodePair().second));
+    }
+}
+
+TEST(DynamicTopologicalOrderTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node3, node4);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge4(4, node4, node1);
+    CXXGRAPH::UndirectedEdge<int> edge5(5, node1, node3);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::TRAVERSAL::DynamicTopologicalOrder<int> order(graph);
+    ASSERT_TRUE(order.isAcyclic());
+    ASSERT_EQ(order.getErrorMessage(), "");
+
+    // every edge goes backward in the order of the insertion of the nodes
+    ASSERT_TRUE(order.addEdge(&edge2));
+    ASSERT_TRUE(order.addEdge(&edge3));
+    checkOrder(graph, order);
+    std::vector<const CXXGRAPH::Node<int> *> expected = {&node1, &node2, &node3, &node4};
+    ASSERT_EQ(order.getOrder(), expected);
+    ASSERT_GT(order.getTotalMovedNodes(), 0);
+
+    // the edges that close a cycle are rejected and the graph is not modified
+    ASSERT_FALSE(order.addEdge(&edge4));
+    ASSERT_FALSE(order.addEdge(&edge5));
+    ASSERT_EQ(graph.getEdgeSet().size(), 3);
+    ASSERT_TRUE(order.isAcyclic());
+    ASSERT_EQ(order.getNumberOfUpdates(), 4);
+    ASSERT_TRUE(order.addEdge(&edge1));
+    ASSERT_EQ(order.getNumberOfUpdates(), 4);
+}
+
+// the edges are accepted if and only if the head does not reach the tail
+TEST(DynamicTopologicalOrderTest, test_2)
+{
+    std::mt19937 generator(3);
+    const int numberOfNodes = 300;
+    std::uniform_int_distribution<int> nodeDistribution(0, numberOfNodes - 1);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < numberOfNodes; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    CXXGRAPH::Graph<int> graph;
+    CXXGRAPH::TRAVERSAL::DynamicTopologicalOrder<int> order(graph);
+    std::vector<std::vector<int>> adjacency(numberOfNodes);
+    auto reaches = [&](int from, int to)
+    {
+        std::vector<bool> visited(numberOfNodes, false);
+        std::vector<int> stack = {from};
+        visited[from] = true;
+        while (!stack.empty())
+        {
+            auto node = stack.back();
+            stack.pop_back();
+            if (node == to)
+            {
+                return true;
+            }
+            for (auto next : adjacency[node])
+            {
+                if (!visited[next])
+                {
+                    visited[next] = true;
+                    stack.push_back(next);
+                }
+            }
+        }
+        return false;
+    };
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+    int accepted = 0;
+    for (int i = 0; i < 3000; ++i)
+    {
+        auto from = nodeDistribution(generator);
+        auto to = nodeDistribution(generator);
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[from], *nodes[to]));
+        auto closesCycle = reaches(to, from);
+        ASSERT_EQ(order.addEdge(edges.back().get()), !closesCycle);
+        if (!closesCycle)
+        {
+            adjacency[from].push_back(to);
+            ++accepted;
+        }
+    }
+    ASSERT_EQ(graph.getEdgeSet().size(), accepted);
+    ASSERT_TRUE(order.isAcyclic());
+    checkOrder(graph, order);
+    ASSERT_EQ(order.getNumberOfUpdates(), 3000);
+    ASSERT_GT(order.getTotalVisitedNodes(), 0);
+    ASSERT_DOUBLE_EQ(order.getAmortizedVisitedNodes(), static_cast<double>(order.getTotalVisitedNodes()) / 3000);
+}
+
+// edges added and removed directly on the graph
+TEST(DynamicTopologicalOrderTest, test_3)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node3, node1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::TRAVERSAL::DynamicTopologicalOrder<int> order(graph);
+    checkOrder(graph, order);
+
+    graph.addEdge(&edge3);
+    ASSERT_FALSE(order.isAcyclic());
+    ASSERT_EQ(order.getErrorMessage(), CXXGRAPH::ERR_CYCLIC_GRAPH);
+    ASSERT_FALSE(order.addEdge(&edge3));
+
+    // without edge1 the edge kept aside is inserted
+    graph.removeEdge(1);
+    ASSERT_TRUE(order.isAcyclic());
+    checkOrder(graph, order);
+
+    // the order is rebuilt with the new edge set
+    edgeSet.insert(&edge3);
+    graph.setEdgeSet(edgeSet);
+    ASSERT_FALSE(order.isAcyclic());
+    edgeSet.erase(&edge2);
+    graph.setEdgeSet(edgeSet);
+    ASSERT_TRUE(order.isAcyclic());
+    checkOrder(graph, order);
+}
+
+// the rejected edges do not add nodes, the nodes left without edges leave the order
+TEST(DynamicTopologicalOrderTest, test_4)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node3, node3);
+    CXXGRAPH::UndirectedEdge<int> edge3(3, node3, node4);
+    CXXGRAPH::DirectedEdge<int> edge4(4, node2, node3);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::TRAVERSAL::DynamicTopologicalOrder<int> order(graph);
+    ASSERT_FALSE(order.addEdge(&edge2));
+    ASSERT_FALSE(order.addEdge(&edge3));
+    checkOrder(graph, order);
+    ASSERT_FALSE(order.isBefore(node1, node3));
+
+    ASSERT_TRUE(order.addEdge(&edge4));
+    checkOrder(graph, order);
+    graph.removeEdge(4);
+    checkOrder(graph, order);
+    std::vector<const CXXGRAPH::Node<int> *> expected = {&node1, &node2};
+    ASSERT_EQ(order.getOrder(), expected);
+    ASSERT_FALSE(order.isBefore(node2, node3));
+
+    // a self loop added to the graph keeps its node, until it is removed
+    graph.addEdge(&edge2);
+    ASSERT_FALSE(order.isAcyclic());
+    ASSERT_EQ(order.getOrder().size(), 3);
+    graph.removeEdge(2);
+    ASSERT_TRUE(order.isAcyclic());
+    ASSERT_EQ(order.getOrder(), expected);
+    ASSERT_TRUE(order.addEdge(&edge4));
+    checkOrder(graph, order);
+}
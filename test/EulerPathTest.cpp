@@ -110,4 +110,115 @@ TEST(EulerPathTest, test_3)
 
         ASSERT_FALSE(check);
     }
-}
\ No newline at end of file
+}
+
+// the path starts from the node with an extra outgoing edge and uses every edge once
+TEST(EulerPathTest, test_4)
+{
+    CXXGRAPH::Node<int> node0("0", 0);
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node3, node1);
+    CXXGRAPH::DirectedEdge<int> edge4(4, node0, node1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.hierholzer();
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_FALSE(res.isCircuit);
+    std::vector<const CXXGRAPH::Node<int> *> expectedNodes = {&node0, &node1, &node2, &node3, &node1};
+    std::vector<const CXXGRAPH::Edge<int> *> expectedEdges = {&edge4, &edge1, &edge2, &edge3};
+    ASSERT_EQ(res.nodes, expectedNodes);
+    ASSERT_EQ(res.edges, expectedEdges);
+
+    // two nodes with an extra outgoing edge
+    CXXGRAPH::DirectedEdge<int> edge5(5, node0, node2);
+    edgeSet.insert(&edge5);
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    res = graph1.hierholzer();
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_EULERIAN_PATH);
+    ASSERT_TRUE(graph1.eulerianPath().empty());
+
+    // balanced degrees but two components
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::Node<int> node5("5", 5);
+    CXXGRAPH::DirectedEdge<int> edge6(6, node4, node5);
+    CXXGRAPH::DirectedEdge<int> edge7(7, node5, node4);
+    edgeSet.erase(&edge4);
+    edgeSet.erase(&edge5);
+    edgeSet.insert(&edge6);
+    edgeSet.insert(&edge7);
+    CXXGRAPH::Graph<int> graph2(edgeSet);
+    res = graph2.hierholzer();
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_EULERIAN_PATH);
+
+    // directed and undirected edges
+    CXXGRAPH::UndirectedEdge<int> edge8(8, node3, node4);
+    edgeSet.insert(&edge8);
+    CXXGRAPH::Graph<int> graph3(edgeSet);
+    res = graph3.hierholzer();
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_MIXED_GRAPH);
+}
+
+// undirected graphs: a circuit, and a path between the two nodes of odd degree
+TEST(EulerPathTest, test_5)
+{
+    const int n = 200000;
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < n; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    // a cycle of all the nodes and the chords i, i + 2 for every even i
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < n; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(i, *nodes[i], *nodes[(i + 1) % n]));
+        edgeSet.insert(edges.back().get());
+    }
+    for (int i = 0; i < n; i += 2)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(n + i, *nodes[i], *nodes[(i + 2) % n]));
+        edgeSet.insert(edges.back().get());
+    }
+    auto check = [](const CXXGRAPH::EulerianPathResult<int> &res, std::size_t numberOfEdges)
+    {
+        ASSERT_TRUE(res.success);
+        ASSERT_EQ(res.edges.size(), numberOfEdges);
+        ASSERT_EQ(res.nodes.size(), numberOfEdges + 1);
+        std::unordered_set<const CXXGRAPH::Edge<int> *> used;
+        for (std::size_t i = 0; i < res.edges.size(); ++i)
+        {
+            ASSERT_TRUE(used.insert(res.edges[i]).second);
+            auto pair = res.edges[i]->getNodePair();
+            ASSERT_TRUE((pair.first == res.nodes[i] && pair.second == res.nodes[i + 1]) ||
+                        (pair.second == res.nodes[i] && pair.first == res.nodes[i + 1]));
+        }
+    };
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.hierholzer();
+    check(res, edgeSet.size());
+    ASSERT_TRUE(res.isCircuit);
+    ASSERT_EQ(res.nodes.front(), res.nodes.back());
+
+    // without the chord 0, 2 the nodes 0 and 2 have odd degree
+    edgeSet.erase(edges[n].get());
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    res = graph1.hierholzer();
+    check(res, edgeSet.size());
+    ASSERT_FALSE(res.isCircuit);
+    std::set<const CXXGRAPH::Node<int> *> ends = {res.nodes.front(), res.nodes.back()};
+    std::set<const CXXGRAPH::Node<int> *> expectedEnds = {nodes[0].get(), nodes[2].get()};
+    ASSERT_EQ(ends, expectedEnds);
+}
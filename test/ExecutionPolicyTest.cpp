@@ -0,0 +1,170 @@
+#include <random>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+#include "DefaultPoolGuard.hpp"
+
+// random directed weighted graph shared by the tests
+class ExecutionPolicyGraph
+{
+public:
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+
+    ExecutionPolicyGraph(int numberOfNodes, int numberOfEdges, bool acyclic)
+    {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> nodeDistribution(0, numberOfNodes - 1);
+        std::uniform_int_distribution<int> weightDistribution(1, 20);
+        for (int i = 0; i < numberOfNodes; ++i)
+        {
+            nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+        }
+        for (int i = 0; i < numberOfEdges; ++i)
+        {
+            auto from = nodeDistribution(generator);
+            auto to = nodeDistribution(generator);
+            if (acyclic && from >= to)
+            {
+                continue;
+            }
+            edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weightDistribution(generator)));
+            edgeSet.insert(edges.back().get());
+        }
+    }
+};
+
+// the sequential policy gives the results of the overloads without a policy
+TEST(ExecutionPolicyTest, test_1)
+{
+    ExecutionPolicyGraph random(200, 800, false);
+    CXXGRAPH::Graph<int> graph(random.edgeSet);
+    const auto sequential = CXXGRAPH::ExecutionPolicy::sequential();
+    ASSERT_TRUE(sequential.isSequential());
+    ASSERT_EQ(sequential.getNumberOfThreads(), 1);
+    const auto &source = *random.nodes[0];
+    const auto &target = *random.nodes[1];
+
+    auto bellmanford = graph.bellmanford(source, target, sequential);
+    ASSERT_EQ(bellmanford.success, graph.bellmanford(source, target).success);
+    ASSERT_EQ(bellmanford.result, graph.bellmanford(source, target).result);
+
+    ASSERT_EQ(graph.floydWarshallMatrix(sequential).distances, graph.floydWarshallMatrix().distances);
+    ASSERT_EQ(graph.johnson(sequential).distances, graph.johnson().distances);
+
+    auto paths = graph.kShortestPaths(source, target, 5, sequential);
+    auto expectedPaths = graph.kShortestPaths(source, target, 5);
+    ASSERT_EQ(paths.paths, expectedPaths.paths);
+    ASSERT_EQ(paths.costs, expectedPaths.costs);
+
+    std::vector<const CXXGRAPH::Node<int> *> sources = {random.nodes[0].get(), random.nodes[5].get(), random.nodes[9].get()};
+    std::vector<const CXXGRAPH::Node<int> *> targets = {random.nodes[1].get(), random.nodes[2].get()};
+    ASSERT_EQ(graph.manyToMany(sources, targets, sequential).distances, graph.manyToMany(sources, targets).distances);
+    ASSERT_EQ(graph.multi_source_breadth_first_search(sources, targets, sequential).distances, graph.multi_source_breadth_first_search(sources, targets).distances);
+    ASSERT_EQ(graph.multi_source_reachability(sources, sequential).reachableCount, graph.multi_source_reachability(sources).reachableCount);
+
+    ASSERT_EQ(graph.breadth_first_search(source, sequential), graph.breadth_first_search(source));
+    ASSERT_EQ(graph.direction_optimizing_breadth_first_search(source, sequential).parent, graph.direction_optimizing_breadth_first_search(source).parent);
+    ASSERT_EQ(graph.graph_slicing(source, sequential), graph.graph_slicing(source));
+    ASSERT_EQ(graph.connectedComponents(sequential).componentId, graph.connectedComponents().componentId);
+    ASSERT_EQ(graph.isConnectedGraph(sequential), graph.isConnectedGraph());
+    ASSERT_EQ(graph.tarjan(sequential).componentId, graph.tarjan().componentId);
+    ASSERT_EQ(graph.forward_backward_scc(sequential).componentId, graph.forward_backward_scc().componentId);
+
+    ExecutionPolicyGraph dag(200, 800, true);
+    CXXGRAPH::Graph<int> dagGraph(dag.edgeSet);
+    auto kahn = dagGraph.kahn(sequential);
+    ASSERT_TRUE(kahn.success);
+    ASSERT_EQ(kahn.nodesInTopoOrder, dagGraph.kahn().nodesInTopoOrder);
+    ASSERT_EQ(dagGraph.topologicalLevels(sequential).nodesInTopoOrder, dagGraph.topologicalLevels().nodesInTopoOrder);
+}
+
+// the parallel policies give the same distances and components
+TEST(ExecutionPolicyTest, test_2)
+{
+    ExecutionPolicyGraph random(300, 1500, false);
+    CXXGRAPH::Graph<int> graph(random.edgeSet);
+    CXXGRAPH::ThreadPool pool(2);
+    for (const auto &policy : {CXXGRAPH::ExecutionPolicy::parallel(4), CXXGRAPH::ExecutionPolicy::on(pool)})
+    {
+        ASSERT_FALSE(policy.isSequential());
+        const auto &source = *random.nodes[0];
+        ASSERT_EQ(graph.johnson(policy).distances, graph.johnson().distances);
+        ASSERT_EQ(graph.floydWarshallMatrix(policy).distances, graph.floydWarshallMatrix().distances);
+        ASSERT_EQ(graph.direction_optimizing_breadth_first_search(source, policy).depth, graph.direction_optimizing_breadth_first_search(source).depth);
+
+        auto visited = graph.breadth_first_search(source, policy);
+        auto expected = graph.breadth_first_search(source);
+        ASSERT_EQ(visited.size(), expected.size());
+        ASSERT_TRUE(std::is_permutation(visited.begin(), visited.end(), expected.begin()));
+
+        // the ids of the components are labels, the partition of the nodes is the same
+        auto components = graph.tarjan(policy);
+        auto expectedComponents = graph.tarjan();
+        ASSERT_TRUE(components.success);
+        ASSERT_EQ(components.numberOfComponents, expectedComponents.numberOfComponents);
+        for (std::size_t i = 0; i < components.componentId.size(); ++i)
+        {
+            for (std::size_t j = i + 1; j < components.componentId.size(); ++j)
+            {
+                ASSERT_EQ(components.componentId[i] == components.componentId[j], expectedComponents.componentId[i] == expectedComponents.componentId[j]);
+            }
+        }
+        ASSERT_EQ(graph.connectedComponents(policy).componentId, graph.connectedComponents().componentId);
+    }
+    ASSERT_EQ(CXXGRAPH::ExecutionPolicy::on(pool).getNumberOfThreads(), 2);
+    ASSERT_EQ(&CXXGRAPH::ExecutionPolicy::on(pool).getPool(), &pool);
+}
+
+// the parallel kernels run on the pool of the policy
+TEST(ExecutionPolicyTest, test_3)
+{
+    CXXGRAPH::ThreadPool pool(2);
+    auto policy = CXXGRAPH::ExecutionPolicy::on(pool, 3);
+    ASSERT_NE(&CXXGRAPH::ThreadPool::getCurrent(), &pool);
+    policy.run([&]()
+               {
+                   ASSERT_EQ(&CXXGRAPH::ThreadPool::getCurrent(), &pool);
+                   CXXGRAPH::parallelFor(0, 64, policy.getNumberOfThreads(), 1, [&](std::size_t, std::size_t, unsigned int threadId)
+                                         {
+                                             ASSERT_LT(threadId, 3);
+                                             ASSERT_EQ(&CXXGRAPH::ThreadPool::getCurrent(), &pool);
+                                         });
+               });
+    ASSERT_NE(&CXXGRAPH::ThreadPool::getCurrent(), &pool);
+
+    ExecutionPolicyGraph dag(500, 3000, true);
+    CXXGRAPH::Graph<int> graph(dag.edgeSet);
+    auto order = graph.kahn(policy);
+    ASSERT_TRUE(order.success);
+    ASSERT_EQ(order.nodesInTopoOrder.size(), graph.getNodeSet().size());
+    std::unordered_map<unsigned long long, std::size_t> position;
+    for (std::size_t i = 0; i < order.nodesInTopoOrder.size(); ++i)
+    {
+        position[order.nodesInTopoOrder[i].getId()] = i;
+    }
+    for (const auto &edge : dag.edges)
+    {
+        ASSERT_LT(position[edge->getNodePair().first->getId()], position[edge->getNodePair().second->getId()]);
+    }
+}
+
+// the sequential policy runs inline without the default pool
+TEST(ExecutionPolicyTest, test_4)
+{
+    ExecutionPolicyGraph random(200, 800, false);
+    CXXGRAPH::Graph<int> graph(random.edgeSet);
+    auto policy = CXXGRAPH::ExecutionPolicy::sequential();
+    auto expectedComponents = graph.connectedComponents();
+    auto expectedPath = graph.bellmanford(*random.nodes[0], *random.nodes[1]);
+    // any access to the default pool would dereference a null pointer
+    DefaultPoolGuard guard(nullptr);
+    ASSERT_TRUE(policy.isSequential());
+    ASSERT_EQ(policy.run([]()
+                         { return 7; }),
+              7);
+    ASSERT_EQ(graph.connectedComponents(policy).componentId, expectedComponents.componentId);
+    ASSERT_EQ(graph.bellmanford(*random.nodes[0], *random.nodes[1], policy).result, expectedPath.result);
+    ASSERT_EQ(graph.breadth_first_search(*random.nodes[0], policy).size(), graph.breadth_first_search(*random.nodes[0]).size());
+}
@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 #include <map>
@@ -116,4 +117,118 @@ TEST(FWTest, test_4)
     ASSERT_FALSE(res.success);
     ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
 
-}
\ No newline at end of file
+}
+
+// dense matrix on more blocks, sequential and parallel
+TEST(FWTest, test_5)
+{
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> nodeDistribution(0, 149);
+    std::uniform_int_distribution<int> weightDistribution(1, 40);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 150; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 600; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.floydWarshallMatrix();
+    auto parallelRes = graph.floydWarshallMatrix(4);
+    ASSERT_TRUE(res.success);
+    ASSERT_FALSE(res.negativeCycle);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.rowNodes.size(), graph.getNodeSet().size());
+    ASSERT_EQ(res.distances, parallelRes.distances);
+    auto fwRes = graph.floydWarshall();
+    ASSERT_EQ(fwRes.result.size(), res.distances.size());
+    for (std::size_t row = 0; row < res.rowNodes.size(); row += 7)
+    {
+        for (std::size_t column = 0; column < res.columnNodes.size(); ++column)
+        {
+            auto expected = graph.dijkstra(*res.rowNodes[row], *res.columnNodes[column]);
+            auto key = std::make_pair(res.rowNodes[row]->getUserId(), res.columnNodes[column]->getUserId());
+            if (expected.success)
+            {
+                ASSERT_EQ(res.at(row, column), expected.result);
+            }
+            else
+            {
+                ASSERT_EQ(res.at(row, column), CXXGRAPH::INF_DOUBLE);
+            }
+            ASSERT_EQ(fwRes.result.at(key), res.at(row, column));
+        }
+    }
+}
+
+// negative cycle found by the parallel blocks
+TEST(FWTest, test_6)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 100; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 100; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[i], *nodes[(i + 1) % 100], (i == 70) ? -200 : 1));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.floydWarshallMatrix(4);
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.negativeCycle);
+    ASSERT_EQ(res.errorMessage, "");
+    auto fwRes = res.toFWResult();
+    ASSERT_TRUE(fwRes.success);
+    ASSERT_TRUE(fwRes.negativeCycle);
+}
+
+// undirected edges give both arcs, parallel edges keep the minimum weight, a positive self loop keeps the
+// distance of a node to itself at 0 and a negative one is a negative cycle
+TEST(FWTest, test_7)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge1(1, node1, node2, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 5);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node2, node3, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node2, node3, 9);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::FWResult res = graph.floydWarshall();
+    ASSERT_TRUE(res.success);
+    ASSERT_FALSE(res.negativeCycle);
+    ASSERT_EQ(res.result.at(std::make_pair(std::string("1"), std::string("2"))), 4);
+    ASSERT_EQ(res.result.at(std::make_pair(std::string("2"), std::string("1"))), 4);
+    ASSERT_EQ(res.result.at(std::make_pair(std::string("2"), std::string("3"))), 2);
+    ASSERT_EQ(res.result.at(std::make_pair(std::string("1"), std::string("3"))), 6);
+    ASSERT_EQ(res.result.at(std::make_pair(std::string("3"), std::string("1"))), CXXGRAPH::INF_DOUBLE);
+
+    CXXGRAPH::DirectedWeightedEdge<int> edge6(6, node1, node1, 3);
+    edgeSet.insert(&edge6);
+    CXXGRAPH::Graph<int> graph2(edgeSet);
+    res = graph2.floydWarshall();
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result.at(std::make_pair(std::string("1"), std::string("1"))), 0);
+    edgeSet.erase(&edge6);
+
+    CXXGRAPH::DirectedWeightedEdge<int> edge5(5, node3, node3, -1);
+    edgeSet.insert(&edge5);
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    res = graph1.floydWarshall();
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.negativeCycle);
+}
@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -151,4 +152,89 @@ TEST(GraphSlicingTest, test_5)
     std::vector<CXXGRAPH::Node<int>> res = graph.graph_slicing(node4);
     ASSERT_EQ(res.size(), 0);
 
-}
\ No newline at end of file
+}
+
+// same slice of the definition on random graphs, sequential and parallel
+TEST(GraphSlicingTest, test_6)
+{
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> nodeDistribution(0, 149);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 150; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 160; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)]));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto nodeSet = graph.getNodeSet();
+    for (const auto &start : nodeSet)
+    {
+        // C minus the nodes reachable from C'
+        auto C = graph.depth_first_search(*start);
+        std::set<unsigned long long> inC, inM;
+        for (const auto &node : C)
+        {
+            inC.insert(node.getId());
+        }
+        for (const auto &node : nodeSet)
+        {
+            if (!inC.count(node->getId()))
+            {
+                for (const auto &reached : graph.depth_first_search(*node))
+                {
+                    inM.insert(reached.getId());
+                }
+            }
+        }
+        std::vector<CXXGRAPH::Node<int>> expected;
+        for (const auto &node : C)
+        {
+            if (!inM.count(node.getId()))
+            {
+                expected.push_back(node);
+            }
+        }
+        ASSERT_EQ(graph.graph_slicing(*start), expected);
+        auto parallel = graph.graph_slicing(*start, 4);
+        ASSERT_EQ(parallel.size(), expected.size());
+        ASSERT_TRUE(std::is_permutation(parallel.begin(), parallel.end(), expected.begin()));
+    }
+}
+
+// a deep graph of 100k nodes
+TEST(GraphSlicingTest, test_7)
+{
+    const int n = 100000;
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < n; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    // chain from 0, with a side chain of the odd half entering it in the middle
+    for (int i = 0; i + 1 < n / 2; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[i], *nodes[i + 1]));
+        edgeSet.insert(edges.back().get());
+    }
+    for (int i = n / 2; i + 1 < n; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[i], *nodes[i + 1]));
+        edgeSet.insert(edges.back().get());
+    }
+    edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(n, *nodes[n - 1], *nodes[n / 4]));
+    edgeSet.insert(edges.back().get());
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.graph_slicing(*nodes[0]);
+    ASSERT_EQ(res.size(), n / 4);
+    ASSERT_EQ(res.front(), *nodes[0]);
+    ASSERT_EQ(res.back(), *nodes[n / 4 - 1]);
+    ASSERT_EQ(graph.graph_slicing(*nodes[0], 2).size(), n / 4);
+}
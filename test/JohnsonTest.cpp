@@ -0,0 +1,115 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+// same distances of floyd-warshall with negative weights
+TEST(JohnsonTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node2, node1, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node1, node3, -2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node3, node4, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node4, node2, -1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge5(3, node2, node3, 3);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    edgeSet.insert(&edge5);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.johnson();
+    ASSERT_TRUE(res.success);
+    ASSERT_FALSE(res.negativeCycle);
+    ASSERT_EQ(res.errorMessage, "");
+    auto expected = graph.floydWarshallMatrix();
+    ASSERT_EQ(res.rowNodes, expected.rowNodes);
+    ASSERT_EQ(res.columnNodes, expected.columnNodes);
+    ASSERT_EQ(res.distances, expected.distances);
+    auto fwRes = res.toFWResult();
+    ASSERT_EQ(fwRes.result.at(std::make_pair(std::string("1"), std::string("2"))), -1);
+    ASSERT_EQ(fwRes.result.at(std::make_pair(std::string("2"), std::string("4"))), 4);
+}
+
+// random graph with negative weights, dense, parallel and streamed results
+TEST(JohnsonTest, test_2)
+{
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<int> nodeDistribution(0, 119);
+    std::uniform_int_distribution<int> weightDistribution(0, 30);
+    std::uniform_int_distribution<int> potentialDistribution(0, 50);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<int> potential;
+    for (int i = 0; i < 120; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+        potential.push_back(potentialDistribution(generator));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 500; ++i)
+    {
+        auto from = nodeDistribution(generator);
+        auto to = nodeDistribution(generator);
+        edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weightDistribution(generator) + potential[from] - potential[to]));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto expected = graph.floydWarshallMatrix();
+    auto res = graph.johnson();
+    ASSERT_TRUE(res.success);
+    ASSERT_FALSE(res.negativeCycle);
+    ASSERT_EQ(res.distances, expected.distances);
+    auto parallelRes = graph.johnson(4);
+    ASSERT_EQ(parallelRes.distances, expected.distances);
+
+    std::map<const CXXGRAPH::Node<int> *, std::vector<double>> rows;
+    auto streamedRes = graph.johnson([&rows](const CXXGRAPH::Node<int> *source, const std::vector<double> &distances)
+                                     { rows[source] = distances; },
+                                     4);
+    ASSERT_TRUE(streamedRes.success);
+    ASSERT_TRUE(streamedRes.distances.empty());
+    ASSERT_EQ(rows.size(), streamedRes.rowNodes.size());
+    for (std::size_t row = 0; row < streamedRes.rowNodes.size(); ++row)
+    {
+        const auto &distances = rows.at(streamedRes.rowNodes[row]);
+        ASSERT_TRUE(std::equal(distances.begin(), distances.end(), expected.distances.begin() + row * expected.columnNodes.size()));
+    }
+}
+
+// negative cycle and errors
+TEST(JohnsonTest, test_3)
+{
+    CXXGRAPH::Node<int> node0("0", 0);
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node0, node1, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node1, node2, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node2, node0, -7);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    bool called = false;
+    auto res = graph.johnson([&called](const CXXGRAPH::Node<int> *, const std::vector<double> &)
+                             { called = true; });
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.negativeCycle);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_FALSE(called);
+    auto fwRes = graph.johnson(2).toFWResult();
+    ASSERT_TRUE(fwRes.success);
+    ASSERT_TRUE(fwRes.negativeCycle);
+    ASSERT_TRUE(fwRes.result.empty());
+
+    CXXGRAPH::DirectedEdge<int> edge4(4, node0, node2);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    res = graph1.johnson();
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+}
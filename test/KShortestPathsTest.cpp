@@ -0,0 +1,182 @@
+#include <random>
+#include <functional>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(KShortestPathsTest, test_1)
+{
+    CXXGRAPH::Node<int> nodeC("C", 1);
+    CXXGRAPH::Node<int> nodeD("D", 2);
+    CXXGRAPH::Node<int> nodeE("E", 3);
+    CXXGRAPH::Node<int> nodeF("F", 4);
+    CXXGRAPH::Node<int> nodeG("G", 5);
+    CXXGRAPH::Node<int> nodeH("H", 6);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, nodeC, nodeD, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, nodeC, nodeE, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, nodeD, nodeF, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, nodeE, nodeD, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge5(5, nodeE, nodeF, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge6(6, nodeE, nodeG, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge7(7, nodeF, nodeG, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge8(8, nodeF, nodeH, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge9(9, nodeG, nodeH, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    edgeSet.insert(&edge5);
+    edgeSet.insert(&edge6);
+    edgeSet.insert(&edge7);
+    edgeSet.insert(&edge8);
+    edgeSet.insert(&edge9);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.kShortestPaths(nodeC, nodeH, 3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.paths.size(), 3);
+    ASSERT_EQ(res.costs, std::vector<double>({5, 7, 8}));
+    ASSERT_EQ(res.paths[0], std::vector<unsigned long long>({2, 5, 8}));
+    ASSERT_EQ(res.paths[1], std::vector<unsigned long long>({2, 6, 9}));
+
+    // all the loopless paths
+    res = graph.kShortestPaths(nodeC, nodeH, 100);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.costs, std::vector<double>({5, 7, 8, 8, 8, 11, 11}));
+
+    res = graph.kShortestPaths(nodeC, nodeC, 3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.paths.size(), 1);
+    ASSERT_TRUE(res.paths[0].empty());
+    ASSERT_EQ(res.costs[0], 0);
+}
+
+// errors
+TEST(KShortestPathsTest, test_2)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node3, node2, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.kShortestPaths(node4, node2, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = graph.kShortestPaths(node1, node4, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    res = graph.kShortestPaths(node1, node3, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node3);
+    graph.addEdge(&edge3);
+    res = graph.kShortestPaths(node1, node3, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+
+    graph.removeEdge(3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node3, -1);
+    graph.addEdge(&edge4);
+    res = graph.kShortestPaths(node1, node3, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+}
+
+// same costs of the enumeration of all the loopless paths, sequential and parallel
+TEST(KShortestPathsTest, test_3)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 9);
+    std::uniform_int_distribution<int> weightDistribution(1, 10);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 10; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 30; ++i)
+    {
+        auto from = nodeDistribution(generator);
+        auto to = nodeDistribution(generator);
+        if (i % 4 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weightDistribution(generator)));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weightDistribution(generator)));
+        }
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+
+    for (const auto &source : graph.getNodeSet())
+    {
+        for (const auto &target : graph.getNodeSet())
+        {
+            // enumerate all the loopless paths
+            std::vector<double> expected;
+            std::set<const CXXGRAPH::Node<int> *> onPath = {source};
+            std::function<void(const CXXGRAPH::Node<int> *, double)> enumerate = [&](const CXXGRAPH::Node<int> *node, double cost)
+            {
+                if (node == target)
+                {
+                    expected.push_back(cost);
+                    return;
+                }
+                for (const auto &edge : graph.getEdgeSet())
+                {
+                    auto nodePair = edge->getNodePair();
+                    auto weight = dynamic_cast<const CXXGRAPH::Weighted *>(edge)->getWeight();
+                    std::vector<const CXXGRAPH::Node<int> *> nexts;
+                    if (nodePair.first == node)
+                    {
+                        nexts.push_back(nodePair.second);
+                    }
+                    if (nodePair.second == node && edge->isDirected().has_value() && !edge->isDirected().value())
+                    {
+                        nexts.push_back(nodePair.first);
+                    }
+                    for (auto next : nexts)
+                    {
+                        if (onPath.count(next) == 0)
+                        {
+                            onPath.insert(next);
+                            enumerate(next, cost + weight);
+                            onPath.erase(next);
+                        }
+                    }
+                }
+            };
+            enumerate(source, 0);
+            std::sort(expected.begin(), expected.end());
+            if (expected.size() > 20)
+            {
+                expected.resize(20);
+            }
+
+            auto res = graph.kShortestPaths(*source, *target, 20);
+            ASSERT_EQ(res.success, !expected.empty());
+            ASSERT_EQ(res.costs, expected);
+            auto parallelRes = graph.kShortestPaths(*source, *target, 20, 4);
+            ASSERT_EQ(parallelRes.paths, res.paths);
+            ASSERT_EQ(parallelRes.costs, res.costs);
+            for (std::size_t i = 0; i < res.paths.size(); ++i)
+            {
+                double cost = 0;
+                for (auto edgeId : res.paths[i])
+                {
+                    cost += dynamic_cast<const CXXGRAPH::Weighted *>(graph.getEdge(edgeId).value())->getWeight();
+                }
+                ASSERT_EQ(cost, res.costs[i]);
+            }
+        }
+    }
+}
@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 #include "Utility/Typedef.hpp"
@@ -165,3 +166,70 @@ TEST(KahnTest, correct_example_big)
         ASSERT_TRUE(topOrderNodeIds.count(node->getId()));
     }
 }
+
+TEST(KahnTest, levels_random_dag)
+{
+    std::mt19937 generator(5);
+    const int numberOfNodes = 5000;
+    std::uniform_int_distribution<int> nodeDistribution(0, numberOfNodes - 1);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < numberOfNodes; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    // edges from lower to higher index
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < numberOfNodes * 3; ++i)
+    {
+        auto a = nodeDistribution(generator);
+        auto b = nodeDistribution(generator);
+        if (a == b)
+        {
+            continue;
+        }
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[std::min(a, b)], *nodes[std::max(a, b)]));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+
+    // the level of a node is one more than the highest level of its predecessors
+    auto sequential = graph.topologicalLevels();
+    ASSERT_TRUE(sequential.success);
+    ASSERT_EQ(sequential.nodesInTopoOrder.size(), graph.getNodeSet().size());
+    std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> level;
+    for (std::size_t i = 0; i < sequential.nodesInTopoOrder.size(); ++i)
+    {
+        ASSERT_TRUE(i == 0 || sequential.level[i - 1] <= sequential.level[i]);
+        level[sequential.nodesInTopoOrder[i]] = sequential.level[i];
+    }
+    std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> expected;
+    for (const auto &edge : edges)
+    {
+        auto &head = expected[edge->getNodePair().second];
+        head = std::max(head, level.at(edge->getNodePair().first) + 1);
+    }
+    for (const auto &node : graph.getNodeSet())
+    {
+        ASSERT_EQ(level.at(node), expected[node]);
+    }
+    ASSERT_EQ(sequential.numberOfLevels, sequential.level.back() + 1);
+
+    // same levels with more threads
+    auto parallel = graph.topologicalLevels(4);
+    ASSERT_TRUE(parallel.success);
+    ASSERT_EQ(parallel.numberOfLevels, sequential.numberOfLevels);
+    for (std::size_t i = 0; i < parallel.nodesInTopoOrder.size(); ++i)
+    {
+        ASSERT_EQ(level.at(parallel.nodesInTopoOrder[i]), parallel.level[i]);
+    }
+
+    // a back edge closes a cycle
+    CXXGRAPH::DirectedEdge<int> backEdge(numberOfNodes * 3, *edges.back()->getNodePair().second, *edges.back()->getNodePair().first);
+    graph.addEdge(&backEdge);
+    auto cyclic = graph.topologicalLevels(4);
+    ASSERT_FALSE(cyclic.success);
+    ASSERT_EQ(cyclic.errorMessage, CXXGRAPH::ERR_CYCLIC_GRAPH);
+    ASSERT_TRUE(cyclic.nodesInTopoOrder.empty());
+    ASSERT_FALSE(graph.kahn().success);
+}
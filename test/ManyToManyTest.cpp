@@ -0,0 +1,149 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(ManyToManyTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node4, node1, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    std::vector<const CXXGRAPH::Node<int> *> sources = {&node1, &node3};
+    std::vector<const CXXGRAPH::Node<int> *> targets = {&node2, &node3, &node4};
+    auto res = graph.manyToMany(sources, targets);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.rowNodes, sources);
+    ASSERT_EQ(res.columnNodes, targets);
+    ASSERT_EQ(res.distances, std::vector<double>({1, 2, CXXGRAPH::INF_DOUBLE, 7, 0, CXXGRAPH::INF_DOUBLE}));
+
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    auto chRes = ch.manyToMany(sources, targets);
+    ASSERT_FALSE(chRes.success);
+    ASSERT_EQ(chRes.errorMessage, CXXGRAPH::ERR_CH_NOT_BUILT);
+    ASSERT_EQ(ch.build(), 0);
+    chRes = ch.manyToMany(sources, targets);
+    ASSERT_TRUE(chRes.success);
+    ASSERT_EQ(chRes.distances, res.distances);
+}
+
+// same distances of dijkstra on a random graph, sequential and parallel
+TEST(ManyToManyTest, test_2)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 79);
+    std::uniform_int_distribution<int> weightDistribution(0, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 80; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 300; ++i)
+    {
+        if (i % 4 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto nodeSet = graph.getNodeSet();
+    std::vector<const CXXGRAPH::Node<int> *> sources, targets;
+    for (const auto &node : nodeSet)
+    {
+        if (node->getData() % 2 == 0)
+        {
+            sources.push_back(node);
+        }
+        if (node->getData() % 3 != 0)
+        {
+            targets.push_back(node);
+        }
+    }
+    auto res = graph.manyToMany(sources, targets);
+    ASSERT_TRUE(res.success);
+    for (std::size_t row = 0; row < sources.size(); ++row)
+    {
+        for (std::size_t column = 0; column < targets.size(); ++column)
+        {
+            auto expected = graph.dijkstra(*sources[row], *targets[column]);
+            ASSERT_EQ(res.at(row, column), expected.success ? expected.result : CXXGRAPH::INF_DOUBLE);
+        }
+    }
+    auto parallelRes = graph.manyToMany(sources, targets, 4);
+    ASSERT_EQ(parallelRes.distances, res.distances);
+
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    ASSERT_EQ(ch.build(), 0);
+    auto chRes = ch.manyToMany(sources, targets);
+    ASSERT_TRUE(chRes.success);
+    ASSERT_EQ(chRes.distances, res.distances);
+    chRes = ch.manyToMany(sources, targets, 4);
+    ASSERT_EQ(chRes.distances, res.distances);
+}
+
+// errors
+TEST(ManyToManyTest, test_3)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.manyToMany({&node3}, {&node2});
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = graph.manyToMany({&node1}, {&node3});
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    // empty sets of nodes give an empty matrix
+    res = graph.manyToMany({}, {&node2});
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.distances.empty());
+    CXXGRAPH::SHORTESTPATH::ContractionHierarchy<int> ch(graph);
+    ASSERT_EQ(ch.build(), 0);
+    res = ch.manyToMany({&node3}, {&node2});
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = ch.manyToMany({&node1}, {&node3});
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    res = ch.manyToMany({&node1, &node2}, {});
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.rowNodes.size(), 2);
+    ASSERT_TRUE(res.distances.empty());
+    res = ch.manyToMany({}, {&node2});
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.distances.empty());
+    res = graph.manyToMany({&node1, &node2}, {});
+    ASSERT_TRUE(res.success);
+    ASSERT_TRUE(res.distances.empty());
+
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    graph.addEdge(&edge2);
+    res = graph.manyToMany({&node1}, {&node3});
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+    graph.removeEdge(2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node2, node3, -1);
+    graph.addEdge(&edge3);
+    res = graph.manyToMany({&node1}, {&node3});
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+}
@@ -0,0 +1,105 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(MultiSourceBFSTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::UndirectedEdge<int> edge3(3, node3, node4);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    std::vector<const CXXGRAPH::Node<int> *> sources = {&node1, &node4};
+    std::vector<const CXXGRAPH::Node<int> *> targets = {&node1, &node2, &node4};
+    auto res = graph.multi_source_breadth_first_search(sources, targets);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.distances, std::vector<double>({0, 1, 3, CXXGRAPH::INF_DOUBLE, CXXGRAPH::INF_DOUBLE, 0}));
+
+    auto reach = graph.multi_source_reachability(sources);
+    ASSERT_TRUE(reach.success);
+    ASSERT_EQ(reach.reachableCount, std::vector<std::size_t>({4, 2}));
+    ASSERT_EQ(reach.depthSum, std::vector<unsigned long long>({6, 1}));
+    ASSERT_DOUBLE_EQ(reach.closeness(0), 0.5);
+
+    CXXGRAPH::Node<int> node5("5", 5);
+    res = graph.multi_source_breadth_first_search({&node5}, targets);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = graph.multi_source_breadth_first_search(sources, {&node5});
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    reach = graph.multi_source_reachability({&node5});
+    ASSERT_FALSE(reach.success);
+    ASSERT_EQ(reach.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+}
+
+// same depths of a breadth first search from every source, for batches of 64, 256 and 512 sources
+TEST(MultiSourceBFSTest, test_2)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 399);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 400; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 900; ++i)
+    {
+        if (i % 5 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)]));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)]));
+        }
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto nodeSet = graph.getNodeSet();
+    std::vector<const CXXGRAPH::Node<int> *> targets(nodeSet.begin(), nodeSet.end());
+    for (std::size_t numberOfSources : {10, 200, 700})
+    {
+        std::vector<const CXXGRAPH::Node<int> *> sources;
+        for (std::size_t i = 0; i < numberOfSources; ++i)
+        {
+            sources.push_back(targets[(i * 7) % targets.size()]);
+        }
+        auto res = graph.multi_source_breadth_first_search(sources, targets);
+        ASSERT_TRUE(res.success);
+        auto reach = graph.multi_source_reachability(sources);
+        ASSERT_TRUE(reach.success);
+        for (std::size_t row = 0; row < sources.size(); ++row)
+        {
+            auto tree = graph.direction_optimizing_breadth_first_search(*sources[row]);
+            std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> depth;
+            unsigned long long depthSum = 0;
+            for (std::size_t i = 0; i < tree.nodes.size(); ++i)
+            {
+                depth[tree.nodes[i]] = tree.depth[i];
+                depthSum += tree.depth[i];
+            }
+            for (std::size_t column = 0; column < targets.size(); ++column)
+            {
+                auto it = depth.find(targets[column]);
+                ASSERT_EQ(res.at(row, column), it == depth.end() ? CXXGRAPH::INF_DOUBLE : it->second);
+            }
+            ASSERT_EQ(reach.reachableCount[row], tree.nodes.size());
+            ASSERT_EQ(reach.depthSum[row], depthSum);
+        }
+        auto parallelRes = graph.multi_source_breadth_first_search(sources, targets, 3);
+        ASSERT_EQ(parallelRes.distances, res.distances);
+        auto parallelReach = graph.multi_source_reachability(sources, 3);
+        ASSERT_EQ(parallelReach.reachableCount, reach.reachableCount);
+        ASSERT_EQ(parallelReach.depthSum, reach.depthSum);
+    }
+}
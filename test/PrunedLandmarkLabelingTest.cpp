@@ -0,0 +1,267 @@
+#include <cstring>
+#include <fstream>
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(PrunedLandmarkLabelingTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::UndirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::UndirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::UndirectedEdge<int> edge3(3, node2, node4);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(graph);
+    ASSERT_EQ(pll.build(), 0);
+    ASSERT_TRUE(pll.isBuilt());
+    auto res = pll.query(node1, node3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.result, 2);
+    res = pll.query(node4, node4);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 0);
+    // the center of the star is the only hub of the leaves
+    ASSERT_EQ(pll.getLabelSize(node2), 1);
+    ASSERT_EQ(pll.getLabelSize(node1), 2);
+    ASSERT_DOUBLE_EQ(pll.getAverageLabelSize(), 7.0 / 4);
+    ASSERT_GT(pll.getMemorySize(), 0);
+}
+
+// same distances of dijkstra on random directed and undirected weighted graphs, and of BFS on unweighted graphs
+TEST(PrunedLandmarkLabelingTest, test_2)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 59);
+    std::uniform_int_distribution<int> weightDistribution(0, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 60; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    for (int kind = 0; kind < 3; ++kind)
+    {
+        std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+        std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> unitEdges;
+        CXXGRAPH::T_EdgeSet<int> edgeSet;
+        CXXGRAPH::T_EdgeSet<int> unitEdgeSet;
+        for (int i = 0; i < 150; ++i)
+        {
+            auto from = nodeDistribution(generator);
+            auto to = nodeDistribution(generator);
+            if (kind == 0)
+            {
+                edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weightDistribution(generator)));
+                unitEdges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], 1));
+            }
+            else if (kind == 1)
+            {
+                edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], weightDistribution(generator)));
+                unitEdges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], 1));
+            }
+            else
+            {
+                edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[from], *nodes[to]));
+                unitEdges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[from], *nodes[to], 1));
+            }
+            edgeSet.insert(edges.back().get());
+            unitEdgeSet.insert(unitEdges.back().get());
+        }
+        CXXGRAPH::Graph<int> graph(edgeSet);
+        // the distances of an unweighted graph are the ones of the same graph with unit weights
+        CXXGRAPH::Graph<int> expectedGraph(kind == 2 ? unitEdgeSet : edgeSet);
+        CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(graph);
+        ASSERT_EQ(pll.build(), 0);
+        for (const auto &source : graph.getNodeSet())
+        {
+            for (const auto &target : graph.getNodeSet())
+            {
+                auto expected = expectedGraph.dijkstra(*source, *target);
+                auto res = pll.query(*source, *target);
+                ASSERT_EQ(res.success, expected.success);
+                ASSERT_EQ(res.errorMessage, expected.errorMessage);
+                if (expected.success)
+                {
+                    ASSERT_DOUBLE_EQ(res.result, expected.result);
+                }
+            }
+        }
+    }
+}
+
+// errors
+TEST(PrunedLandmarkLabelingTest, test_3)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node3, node2, 1);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(graph);
+    auto res = pll.query(node1, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_PLL_NOT_BUILT);
+    ASSERT_EQ(pll.build(), 0);
+    res = pll.query(node4, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = pll.query(node1, node4);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    res = pll.query(node1, node3);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node3);
+    graph.addEdge(&edge3);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll1(graph);
+    ASSERT_EQ(pll1.build(), -1);
+    ASSERT_EQ(pll1.getErrorMessage(), CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+
+    graph.removeEdge(3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node3, -1);
+    graph.addEdge(&edge4);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll2(graph);
+    ASSERT_EQ(pll2.build(), -1);
+    ASSERT_EQ(pll2.getErrorMessage(), CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+}
+
+// write and read the labels
+TEST(PrunedLandmarkLabelingTest, test_4)
+{
+    CXXGRAPH::Node<int> nodeA("A", 1);
+    CXXGRAPH::Node<int> nodeB("B", 1);
+    CXXGRAPH::Node<int> nodeC("C", 1);
+    CXXGRAPH::Node<int> nodeD("D", 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, nodeA, nodeB, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, nodeA, nodeC, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, nodeC, nodeB, 7);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge4(4, nodeC, nodeD, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(graph);
+    ASSERT_EQ(pll.build(), 0);
+    ASSERT_EQ(pll.writeToFile(".", "pll_test"), 0);
+
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll1(graph1);
+    ASSERT_EQ(pll1.readFromFile(".", "pll_test"), 0);
+    ASSERT_TRUE(pll1.isBuilt());
+    ASSERT_EQ(pll1.getMemorySize(), pll.getMemorySize());
+    ASSERT_EQ(pll1.getLabelSize(nodeD), pll.getLabelSize(nodeD));
+    auto res = pll1.query(nodeD, nodeB);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 9);
+    res = pll1.query(nodeB, nodeD);
+    ASSERT_FALSE(res.success);
+    res = pll1.query(nodeA, nodeD);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 3);
+
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll2(graph1);
+    ASSERT_EQ(pll2.readFromFile(".", "not_existing_pll"), -1);
+    ASSERT_FALSE(pll2.isBuilt());
+}
+
+// a corrupted or truncated file is rejected instead of read out of bounds
+TEST(PrunedLandmarkLabelingTest, test_5)
+{
+    CXXGRAPH::Node<int> nodeA("A", 1);
+    CXXGRAPH::Node<int> nodeB("B", 1);
+    CXXGRAPH::Node<int> nodeC("C", 1);
+    CXXGRAPH::Node<int> nodeD("D", 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, nodeA, nodeB, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, nodeA, nodeC, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, nodeC, nodeB, 7);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge4(4, nodeC, nodeD, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll(graph);
+    ASSERT_EQ(pll.build(), 0);
+    ASSERT_EQ(pll.writeToFile(".", "pll_corrupt_test"), 0);
+
+    std::ifstream ifs("./pll_corrupt_test.pll", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+    // walk to the offsets of the out labels
+    auto readWord = [&content](std::size_t position)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, content.data() + position, sizeof(word));
+        return word;
+    };
+    std::size_t position = sizeof(CXXGRAPH::PLL_FILE_MAGIC);
+    auto n = readWord(position);
+    position += sizeof(uint64_t) + sizeof(uint8_t);
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        position += sizeof(uint64_t) + readWord(position);
+    }
+    position += sizeof(uint64_t) + readWord(position) * sizeof(uint64_t);
+    auto offsetPosition = position + sizeof(uint64_t);
+    auto hubCount = readWord(offsetPosition + n * sizeof(uint64_t));
+    auto hubPosition = offsetPosition + (n + 2) * sizeof(uint64_t);
+    ASSERT_GT(hubCount, 0u);
+
+    CXXGRAPH::SHORTESTPATH::PrunedLandmarkLabeling<int> pll1(graph);
+    // offsets that are not monotone
+    std::string corrupted = content;
+    uint64_t offset = hubCount + 1;
+    std::memcpy(&corrupted[offsetPosition + sizeof(uint64_t)], &offset, sizeof(offset));
+    std::ofstream("./pll_corrupt_test.pll", std::ios::binary) << corrupted;
+    ASSERT_EQ(pll1.readFromFile(".", "pll_corrupt_test"), -1);
+    ASSERT_FALSE(pll1.isBuilt());
+
+    // hub that is not a node
+    corrupted = content;
+    uint32_t hub = static_cast<uint32_t>(n + 5);
+    std::memcpy(&corrupted[hubPosition], &hub, sizeof(hub));
+    std::ofstream("./pll_corrupt_test.pll", std::ios::binary) << corrupted;
+    ASSERT_EQ(pll1.readFromFile(".", "pll_corrupt_test"), -1);
+
+    // label whose hubs are not sorted
+    corrupted = content;
+    bool swapped = false;
+    for (uint64_t i = 0; i < n && !swapped; ++i)
+    {
+        auto begin = readWord(offsetPosition + i * sizeof(uint64_t));
+        if (readWord(offsetPosition + (i + 1) * sizeof(uint64_t)) - begin >= 2)
+        {
+            std::swap_ranges(&corrupted[hubPosition + begin * sizeof(uint32_t)], &corrupted[hubPosition + (begin + 1) * sizeof(uint32_t)],
+                             &corrupted[hubPosition + (begin + 1) * sizeof(uint32_t)]);
+            swapped = true;
+        }
+    }
+    ASSERT_TRUE(swapped);
+    std::ofstream("./pll_corrupt_test.pll", std::ios::binary) << corrupted;
+    ASSERT_EQ(pll1.readFromFile(".", "pll_corrupt_test"), -1);
+
+    // truncated file
+    std::ofstream("./pll_corrupt_test.pll", std::ios::binary) << content.substr(0, content.size() - 5);
+    ASSERT_EQ(pll1.readFromFile(".", "pll_corrupt_test"), -1);
+    ASSERT_FALSE(pll1.isBuilt());
+
+    std::ofstream("./pll_corrupt_test.pll", std::ios::binary) << content;
+    ASSERT_EQ(pll1.readFromFile(".", "pll_corrupt_test"), 0);
+    ASSERT_EQ(pll1.query(nodeA, nodeD).result, 3);
+}
@@ -0,0 +1,237 @@
+#include <random>
+#include <thread>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(ShortestPathCacheTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ShortestPathCache<int> cache(graph);
+    auto res = cache.dijkstra(node1, node3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 2);
+    ASSERT_EQ(cache.getMisses(), 1);
+    ASSERT_EQ(cache.getHits(), 0);
+    res = cache.dijkstra(node1, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 1);
+    ASSERT_EQ(cache.getMisses(), 1);
+    ASSERT_EQ(cache.getHits(), 1);
+    res = cache.dijkstra(node3, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 7);
+    ASSERT_EQ(cache.getMisses(), 2);
+    // another algorithm is another entry
+    auto bellmanFordRes = cache.bellmanford(node1, node3);
+    ASSERT_TRUE(bellmanFordRes.success);
+    ASSERT_EQ(bellmanFordRes.result, 2);
+    ASSERT_EQ(cache.getMisses(), 3);
+    ASSERT_GT(cache.getMemoryUsage(), 0);
+
+    auto tree = cache.getTree(node3, CXXGRAPH::SP_DIJKSTRA);
+    ASSERT_EQ(cache.getHits(), 2);
+    auto path = tree->getPath(node2);
+    ASSERT_EQ(path.size(), 2);
+    ASSERT_EQ(path[0], &edge3);
+    ASSERT_EQ(path[1], &edge1);
+    ASSERT_EQ(cache.getTree(node4, CXXGRAPH::SP_DIJKSTRA), nullptr);
+
+    res = cache.dijkstra(node4, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = cache.dijkstra(node1, node4);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+}
+
+// the trees are invalidated by the modifications of the graph
+TEST(ShortestPathCacheTest, test_2)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 5);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node1, node3, 2);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ShortestPathCache<int> cache(graph);
+    auto version = graph.getVersion();
+    ASSERT_EQ(cache.dijkstra(node1, node3).result, 6);
+
+    graph.addEdge(&edge3);
+    ASSERT_GT(graph.getVersion(), version);
+    ASSERT_EQ(cache.dijkstra(node1, node3).result, 2);
+    ASSERT_EQ(cache.getMisses(), 2);
+    ASSERT_EQ(cache.getHits(), 0);
+
+    // an edge already in the graph does not change the version
+    version = graph.getVersion();
+    graph.addEdge(&edge3);
+    ASSERT_EQ(graph.getVersion(), version);
+    ASSERT_EQ(cache.dijkstra(node1, node3).result, 2);
+    ASSERT_EQ(cache.getHits(), 1);
+
+    graph.removeEdge(3);
+    ASSERT_GT(graph.getVersion(), version);
+    ASSERT_EQ(cache.dijkstra(node1, node3).result, 6);
+    ASSERT_EQ(cache.getMisses(), 3);
+
+    CXXGRAPH::T_EdgeSet<int> edgeSet1;
+    edgeSet1.insert(&edge1);
+    graph.setEdgeSet(edgeSet1);
+    auto res = cache.dijkstra(node1, node3);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    ASSERT_EQ(cache.getMisses(), 4);
+}
+
+// same results of the graph algorithms on a random graph
+TEST(ShortestPathCacheTest, test_3)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> nodeDistribution(0, 49);
+    std::uniform_int_distribution<int> weightDistribution(0, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 50; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 150; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        else
+        {
+            edges.emplace_back(new CXXGRAPH::DirectedWeightedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        }
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ShortestPathCache<int> cache(graph);
+    for (int repeat = 0; repeat < 2; ++repeat)
+    {
+        for (const auto &source : graph.getNodeSet())
+        {
+            for (const auto &target : graph.getNodeSet())
+            {
+                auto expected = graph.dijkstra(*source, *target);
+                auto res = cache.dijkstra(*source, *target);
+                ASSERT_EQ(res.success, expected.success);
+                ASSERT_EQ(res.errorMessage, expected.errorMessage);
+                if (expected.success)
+                {
+                    ASSERT_DOUBLE_EQ(res.result, expected.result);
+                    // the path has the same length of the distance
+                    double length = 0;
+                    for (const auto &edge : cache.getTree(*source, CXXGRAPH::SP_DIJKSTRA)->getPath(*target))
+                    {
+                        length += dynamic_cast<const CXXGRAPH::Weighted *>(edge)->getWeight();
+                    }
+                    ASSERT_DOUBLE_EQ(length, expected.result);
+                }
+                auto expectedBellmanFord = graph.bellmanford(*source, *target);
+                auto resBellmanFord = cache.bellmanford(*source, *target);
+                ASSERT_EQ(resBellmanFord.success, expectedBellmanFord.success);
+                ASSERT_EQ(resBellmanFord.errorMessage, expectedBellmanFord.errorMessage);
+                ASSERT_DOUBLE_EQ(resBellmanFord.result, expectedBellmanFord.result);
+            }
+            auto expectedDial = graph.dial(*source, 20);
+            auto resDial = cache.dial(*source, 20);
+            ASSERT_EQ(resDial.success, expectedDial.success);
+            ASSERT_EQ(resDial.minDistanceMap, expectedDial.minDistanceMap);
+        }
+    }
+    ASSERT_EQ(cache.getMisses(), 3 * graph.getNodeSet().size());
+    ASSERT_EQ(cache.getEvictions(), 0);
+
+    // a negative cycle is reported by bellmanford
+    CXXGRAPH::DirectedWeightedEdge<int> negativeEdge(1000, *nodes[0], *nodes[1], -100);
+    graph.addEdge(&negativeEdge);
+    auto expected = graph.bellmanford(*nodes[0], *nodes[1]);
+    auto res = cache.bellmanford(*nodes[0], *nodes[1]);
+    ASSERT_EQ(res.negativeCycle, expected.negativeCycle);
+    ASSERT_EQ(res.result, expected.result);
+    auto resDijkstra = cache.dijkstra(*nodes[0], *nodes[1]);
+    ASSERT_FALSE(resDijkstra.success);
+    ASSERT_EQ(resDijkstra.errorMessage, CXXGRAPH::ERR_NEGATIVE_WEIGHTED_EDGE);
+}
+
+// byte budget and concurrent queries
+TEST(ShortestPathCacheTest, test_4)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 100; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i + 1 < 100; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[i], *nodes[i + 1], 1));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::SHORTESTPATH::ShortestPathCache<int> cache(graph);
+    auto treeSize = cache.getTree(*nodes[0], CXXGRAPH::SP_DIJKSTRA)->getMemorySize();
+    cache.setByteBudget(treeSize * 3);
+    for (int i = 1; i < 10; ++i)
+    {
+        ASSERT_EQ(cache.dijkstra(*nodes[i], *nodes[0]).result, i);
+        ASSERT_LE(cache.getMemoryUsage(), cache.getByteBudget());
+    }
+    ASSERT_EQ(cache.getEvictions(), 7);
+    // the most recently used trees are still cached
+    ASSERT_EQ(cache.dijkstra(*nodes[9], *nodes[0]).result, 9);
+    ASSERT_EQ(cache.dijkstra(*nodes[8], *nodes[0]).result, 8);
+    ASSERT_EQ(cache.getHits(), 2);
+    ASSERT_EQ(cache.dijkstra(*nodes[1], *nodes[0]).result, 1);
+    ASSERT_EQ(cache.getHits(), 2);
+
+    // a tree larger than the budget is not cached
+    cache.setByteBudget(treeSize - 1);
+    ASSERT_EQ(cache.getMemoryUsage(), 0);
+    ASSERT_EQ(cache.dijkstra(*nodes[5], *nodes[0]).result, 5);
+    ASSERT_EQ(cache.getMemoryUsage(), 0);
+
+    cache.setByteBudget(CXXGRAPH::SP_CACHE_DEFAULT_BYTE_BUDGET);
+    cache.clear();
+    auto hits = cache.getHits();
+    auto misses = cache.getMisses();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, &nodes]()
+                             {
+                                 for (int i = 0; i < 100; ++i)
+                                 {
+                                     auto res = cache.dijkstra(*nodes[i % 10], *nodes[99]);
+                                     EXPECT_EQ(res.result, 99 - i % 10);
+                                 }
+                             });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(cache.getHits() - hits + cache.getMisses() - misses, 400);
+    ASSERT_GE(cache.getMisses() - misses, 10);
+}
@@ -0,0 +1,148 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+// the labels of result give the same partition of the components of kosaraju
+static void checkSamePartition(const CXXGRAPH::ComponentLabelResult<int> &result, const CXXGRAPH::SCCResult<int> &expected)
+{
+    ASSERT_TRUE(result.success);
+    ASSERT_EQ(result.numberOfComponents, expected.stronglyConnectedComps.size());
+    std::unordered_map<std::string, std::size_t> label;
+    for (std::size_t i = 0; i < result.nodes.size(); ++i)
+    {
+        ASSERT_LT(result.componentId[i], result.numberOfComponents);
+        label[result.nodes[i]->getUserId()] = result.componentId[i];
+    }
+    std::set<std::size_t> seen;
+    for (const auto &component : expected.stronglyConnectedComps)
+    {
+        auto componentLabel = label.at(component.front().getUserId());
+        ASSERT_TRUE(seen.insert(componentLabel).second);
+        for (const auto &node : component)
+        {
+            ASSERT_EQ(label.at(node.getUserId()), componentLabel);
+        }
+    }
+}
+
+TEST(StronglyConnectedComponentsTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node1);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge4(4, node3, node4);
+    CXXGRAPH::DirectedEdge<int> edge5(5, node4, node4);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    edgeSet.insert(&edge5);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto expected = graph.kosaraju();
+    auto res = graph.tarjan();
+    ASSERT_EQ(res.errorMessage, "");
+    ASSERT_EQ(res.numberOfComponents, 3);
+    checkSamePartition(res, expected);
+    res = graph.forward_backward_scc(2);
+    ASSERT_EQ(res.errorMessage, "");
+    checkSamePartition(res, expected);
+
+    CXXGRAPH::UndirectedEdge<int> edge6(6, node1, node3);
+    edgeSet.insert(&edge6);
+    CXXGRAPH::Graph<int> graph1(edgeSet);
+    res = graph1.tarjan();
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_UNDIR_GRAPH);
+    res = graph1.forward_backward_scc(2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_UNDIR_GRAPH);
+}
+
+// same components of kosaraju on random graphs, small and big enough for the forward-backward splits
+TEST(StronglyConnectedComponentsTest, test_2)
+{
+    std::mt19937 generator(7);
+    for (int numberOfNodes : {50, 300, 20000})
+    {
+        for (int edgesPerNode : {1, 2})
+        {
+            std::uniform_int_distribution<int> nodeDistribution(0, numberOfNodes - 1);
+            std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+            for (int i = 0; i < numberOfNodes; ++i)
+            {
+                nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+            }
+            std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+            CXXGRAPH::T_EdgeSet<int> edgeSet;
+            for (int i = 0; i < numberOfNodes * edgesPerNode; ++i)
+            {
+                edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)]));
+                edgeSet.insert(edges.back().get());
+            }
+            CXXGRAPH::Graph<int> graph(edgeSet);
+            auto expected = graph.kosaraju();
+            auto res = graph.tarjan();
+            checkSamePartition(res, expected);
+            // the components are numbered in reverse topological order
+            std::unordered_map<const CXXGRAPH::Node<int> *, std::size_t> label;
+            for (std::size_t i = 0; i < res.nodes.size(); ++i)
+            {
+                label[res.nodes[i]] = res.componentId[i];
+            }
+            for (const auto &edge : edges)
+            {
+                ASSERT_GE(label.at(edge->getNodePair().first), label.at(edge->getNodePair().second));
+            }
+            for (unsigned int threads : {1u, 4u})
+            {
+                checkSamePartition(graph.forward_backward_scc(threads), expected);
+            }
+        }
+    }
+}
+
+// a long cycle does not overflow the stack
+TEST(StronglyConnectedComponentsTest, test_3)
+{
+    const std::size_t n = 200000;
+    // out and in CSR of the arcs node -> node + 1, and n - 1 -> 0 if cycle
+    std::vector<std::size_t> offset, adjacency, inOffset, inAdjacency;
+    auto build = [&](bool cycle)
+    {
+        offset.assign(1, 0);
+        inOffset.assign(1, 0);
+        adjacency.clear();
+        inAdjacency.clear();
+        for (std::size_t node = 0; node < n; ++node)
+        {
+            if (node + 1 < n || cycle)
+            {
+                adjacency.push_back((node + 1) % n);
+            }
+            if (node > 0 || cycle)
+            {
+                inAdjacency.push_back((node + n - 1) % n);
+            }
+            offset.push_back(adjacency.size());
+            inOffset.push_back(inAdjacency.size());
+        }
+    };
+    std::vector<std::size_t> componentId;
+    build(true);
+    ASSERT_EQ(CXXGRAPH::TRAVERSAL::csrTarjanSCC(offset, adjacency, componentId), 1);
+    ASSERT_EQ(CXXGRAPH::TRAVERSAL::csrForwardBackwardSCC(offset, adjacency, inOffset, inAdjacency, 4, componentId), 1);
+    // a chain is trimmed to single nodes
+    build(false);
+    ASSERT_EQ(CXXGRAPH::TRAVERSAL::csrTarjanSCC(offset, adjacency, componentId), n);
+    ASSERT_EQ(CXXGRAPH::TRAVERSAL::csrForwardBackwardSCC(offset, adjacency, inOffset, inAdjacency, 4, componentId), n);
+    std::sort(componentId.begin(), componentId.end());
+    for (std::size_t node = 0; node < n; ++node)
+    {
+        ASSERT_EQ(componentId[node], node);
+    }
+}
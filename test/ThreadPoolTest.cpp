@@ -0,0 +1,150 @@
+#include <numeric>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+#include "DefaultPoolGuard.hpp"
+
+// every index is visited once and the thread ids are in [0, numberOfThreads)
+TEST(ThreadPoolTest, test_1)
+{
+    CXXGRAPH::ThreadPool pool(4);
+    ASSERT_EQ(pool.getNumberOfThreads(), 4);
+    std::vector<std::atomic<int>> visits(10000);
+    std::vector<std::size_t> partialSums(4, 0);
+    CXXGRAPH::parallelFor(pool, 0, visits.size(), 4, 64, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+                          {
+                              ASSERT_LT(threadId, 4);
+                              for (auto i = begin; i < end; ++i)
+                              {
+                                  visits[i].fetch_add(1);
+                                  partialSums[threadId] += i;
+                              }
+                          });
+    for (const auto &visit : visits)
+    {
+        ASSERT_EQ(visit.load(), 1);
+    }
+    ASSERT_EQ(std::accumulate(partialSums.begin(), partialSums.end(), std::size_t(0)), std::size_t(10000) * 9999 / 2);
+
+    // a single chunk runs inline
+    unsigned int calls = 0;
+    pool.parallelFor(5, 10, 4, 64, [&](std::size_t begin, std::size_t end, unsigned int threadId)
+                     {
+                         ASSERT_EQ(begin, 5);
+                         ASSERT_EQ(end, 10);
+                         ASSERT_EQ(threadId, 0);
+                         ++calls;
+                     });
+    ASSERT_EQ(calls, 1);
+}
+
+// nested parallel loops and task groups on a pool smaller than the requested threads
+TEST(ThreadPoolTest, test_2)
+{
+    CXXGRAPH::ThreadPool pool(2);
+    std::atomic<std::size_t> sum(0);
+    pool.parallelFor(0, 16, 8, 1, [&](std::size_t begin, std::size_t end, unsigned int)
+                     {
+                         for (auto i = begin; i < end; ++i)
+                         {
+                             pool.parallelFor(0, 1000, 8, 10, [&](std::size_t b, std::size_t e, unsigned int)
+                                              {
+                                                  for (auto j = b; j < e; ++j)
+                                                  {
+                                                      sum.fetch_add(j);
+                                                  }
+                                              });
+                         }
+                     });
+    ASSERT_EQ(sum.load(), std::size_t(16) * 1000 * 999 / 2);
+
+    std::atomic<int> tasks(0);
+    {
+        CXXGRAPH::TaskGroup group(pool);
+        for (int i = 0; i < 100; ++i)
+        {
+            group.run([&]()
+                      {
+                          CXXGRAPH::TaskGroup inner(pool);
+                          inner.run([&]()
+                                    { tasks.fetch_add(1); });
+                          tasks.fetch_add(1);
+                      });
+        }
+        group.wait();
+        ASSERT_EQ(tasks.load(), 200);
+    }
+
+    // a pool without workers runs the tasks on the waiting thread
+    CXXGRAPH::ThreadPool inlinePool(0);
+    CXXGRAPH::TaskGroup group(inlinePool);
+    group.run([&]()
+              { tasks.fetch_add(1); });
+    group.wait();
+    ASSERT_EQ(tasks.load(), 201);
+}
+
+// the algorithms run on the injected default pool
+TEST(ThreadPoolTest, test_3)
+{
+    auto pool = std::make_shared<CXXGRAPH::ThreadPool>(3);
+    DefaultPoolGuard guard(pool);
+    ASSERT_EQ(&CXXGRAPH::ThreadPool::getDefault(), pool.get());
+
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 2000; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    for (int i = 1; i < 2000; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedEdge<int>(i, *nodes[(i - 1) / 2], *nodes[i]));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto sequential = graph.breadth_first_search(*nodes[0]);
+    auto parallel = graph.concurrency_breadth_first_search(*nodes[0], 4);
+    ASSERT_EQ(parallel.size(), sequential.size());
+    ASSERT_EQ(graph.connectedComponents(4).numberOfComponents, 1);
+
+    auto partitionMap = graph.partitionGraph(CXXGRAPH::PARTITIONING::PartitionAlgorithm::HDRF_ALG, 4, 1, 1, 1, 4);
+    std::size_t partitionedEdges = 0;
+    for (const auto &partition : partitionMap)
+    {
+        partitionedEdges += partition.second->getEdgeSet().size();
+    }
+    ASSERT_EQ(partitionedEdges, edges.size());
+}
+
+// the sequential calls run inline and do not need the default pool
+TEST(ThreadPoolTest, test_4)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    for (int i = 0; i < 2000; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    for (int i = 1; i < 2000; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::UndirectedWeightedEdge<int>(i, *nodes[(i - 1) / 2], *nodes[i], 1));
+        edgeSet.insert(edges.back().get());
+    }
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    // any access to the default pool would dereference a null pointer
+    DefaultPoolGuard guard(nullptr);
+    std::size_t visited = 0;
+    CXXGRAPH::parallelFor(0, 10000, 1, 16, [&visited](std::size_t begin, std::size_t end, unsigned int)
+                          { visited += end - begin; });
+    ASSERT_EQ(visited, 10000);
+    CXXGRAPH::TaskGroup group;
+    group.wait();
+    ASSERT_EQ(graph.breadth_first_search(*nodes[0]).size(), nodes.size());
+    ASSERT_EQ(graph.direction_optimizing_breadth_first_search(*nodes[0]).nodes.size(), nodes.size());
+    ASSERT_EQ(graph.connectedComponents().numberOfComponents, 1);
+    ASSERT_EQ(graph.bellmanford(*nodes[0], *nodes[1999]).result, 10);
+    ASSERT_EQ(graph.boruvka().mstCost, 1999);
+    ASSERT_TRUE(graph.dijkstra(*nodes[0], *nodes[1999]).success);
+}
@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(TraversalRangeTest, test_1)
+{
+    CXXGRAPH::Node<int> node1("1", 1);
+    CXXGRAPH::Node<int> node2("2", 2);
+    CXXGRAPH::Node<int> node3("3", 3);
+    CXXGRAPH::Node<int> node4("4", 4);
+    CXXGRAPH::Node<int> node5("5", 5);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node4);
+    CXXGRAPH::UndirectedEdge<int> edge4(4, node4, node5);
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    edgeSet.insert(&edge1);
+    edgeSet.insert(&edge2);
+    edgeSet.insert(&edge3);
+    edgeSet.insert(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+
+    // same nodes of breadth_first_search, with depth and parent
+    std::vector<CXXGRAPH::Node<int>> expected = graph.breadth_first_search(node1);
+    std::vector<CXXGRAPH::Node<int>> visited;
+    std::unordered_map<const CXXGRAPH::Node<int> *, std::pair<std::size_t, const CXXGRAPH::Node<int> *>> tree;
+    for (const auto &step : graph.breadth_first_range(node1))
+    {
+        visited.push_back(*step.node);
+        tree[step.node] = {step.depth, step.parent};
+    }
+    ASSERT_EQ(visited.size(), expected.size());
+    ASSERT_TRUE(std::is_permutation(visited.begin(), visited.end(), expected.begin()));
+    ASSERT_EQ(visited.front(), node1);
+    ASSERT_EQ(tree[&node1], std::make_pair(std::size_t(0), (const CXXGRAPH::Node<int> *)nullptr));
+    ASSERT_EQ(tree[&node3], std::make_pair(std::size_t(2), (const CXXGRAPH::Node<int> *)&node2));
+    ASSERT_EQ(tree[&node5], std::make_pair(std::size_t(2), (const CXXGRAPH::Node<int> *)&node4));
+
+    // same order of depth_first_search
+    expected = graph.depth_first_search(node1);
+    visited.clear();
+    tree.clear();
+    for (const auto &step : graph.depth_first_range(node1))
+    {
+        visited.push_back(*step.node);
+        tree[step.node] = {step.depth, step.parent};
+    }
+    ASSERT_EQ(visited, expected);
+    ASSERT_EQ(tree[&node1], std::make_pair(std::size_t(0), (const CXXGRAPH::Node<int> *)nullptr));
+    ASSERT_EQ(tree[&node3], std::make_pair(std::size_t(2), (const CXXGRAPH::Node<int> *)&node2));
+    ASSERT_EQ(tree[&node5], std::make_pair(std::size_t(2), (const CXXGRAPH::Node<int> *)&node4));
+
+    // start not in the graph
+    CXXGRAPH::Node<int> node6("6", 6);
+    auto range = graph.breadth_first_range(node6);
+    ASSERT_TRUE(range.begin() == range.end());
+    auto dfsRange = graph.depth_first_range(node6);
+    ASSERT_TRUE(dfsRange.begin() == dfsRange.end());
+}
+
+// the traversal stops when the caller leaves the loop
+TEST(TraversalRangeTest, test_2)
+{
+    const int n = 1000;
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < n; ++i)
+    {
+        nodes.emplace_back(new CXXGRAPH::Node<int>(std::to_string(i), i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedEdge<int>>> edges;
+    CXXGRAPH::T_EdgeSet<int> edgeSet;
+    // binary tree, node i has children 2i + 1 and 2i + 2
+    for (int i = 1; i < n; ++i)
+    {
+        edges.emplace_back(new CXXGRAPH::DirectedEdge<int>(i, *nodes[(i - 1) / 2], *nodes[i]));
+        edgeSet.insert(edges.back().get());
+    }
+    auto csr = std::make_shared<const CXXGRAPH::CSRGraph<int>>(edgeSet);
+
+    // nearest node with data multiple of 37
+    CXXGRAPH::TRAVERSAL::BreadthFirstRange<int> range(csr, nodes[0].get());
+    std::size_t yielded = 0;
+    const CXXGRAPH::Node<int> *found = nullptr;
+    std::size_t foundDepth = 0;
+    for (const auto &step : range)
+    {
+        ++yielded;
+        if (step.node->getData() > 0 && step.node->getData() % 37 == 0)
+        {
+            found = step.node;
+            foundDepth = step.depth;
+            break;
+        }
+    }
+    ASSERT_EQ(found, nodes[37].get());
+    ASSERT_EQ(foundDepth, 5);
+    // the levels up to depth 4 have 31 nodes, the traversal stops inside level 5
+    ASSERT_GT(yielded, 31);
+    ASSERT_LE(yielded, 63);
+    ASSERT_FALSE(range.finished());
+
+    // the depth first range goes down to a leaf first
+    CXXGRAPH::TRAVERSAL::DepthFirstRange<int> dfsRange(csr, nodes[0].get());
+    std::vector<int> firstNodes;
+    for (auto it = dfsRange.begin(); it != dfsRange.end() && firstNodes.size() < 8; ++it)
+    {
+        if (!firstNodes.empty())
+        {
+            ASSERT_EQ((it->node->getData() - 1) / 2, firstNodes.back());
+            ASSERT_EQ(it->parent->getData(), firstNodes.back());
+        }
+        firstNodes.push_back(it->node->getData());
+        ASSERT_EQ(it->depth, firstNodes.size() - 1);
+    }
+    ASSERT_EQ(firstNodes.size(), 8);
+}